@@ -11,16 +11,24 @@ namespace precice
 namespace action
 {
 
+namespace
+{
+/// Thread state of the main thread, while the global interpreter lock is released between actions.
+PyThreadState *releasedThreadState = nullptr;
+} // namespace
+
 PythonAction::PythonAction(
     Timing               timing,
     const std::string &  modulePath,
     const std::string &  moduleName,
     const mesh::PtrMesh &mesh,
     int                  targetDataID,
-    int                  sourceDataID)
+    int                  sourceDataID,
+    bool                 releaseGIL)
     : Action(timing, mesh),
       _modulePath(modulePath),
-      _moduleName(moduleName)
+      _moduleName(moduleName),
+      _releaseGIL(releaseGIL)
 {
   if (targetDataID != -1) {
     _targetData = getMesh()->data(targetDataID);
@@ -37,6 +45,10 @@ PythonAction::~PythonAction()
   if (_module != nullptr) {
     assertion(_moduleNameObject != nullptr);
     assertion(_module != nullptr);
+    if (releasedThreadState != nullptr) {
+      PyEval_RestoreThread(releasedThreadState);
+      releasedThreadState = nullptr;
+    }
     Py_DECREF(_moduleNameObject);
     Py_DECREF(_module);
     Py_Finalize();
@@ -53,6 +65,7 @@ void PythonAction::performAction(double time,
   if (not _isInitialized)
     initialize();
 
+  PyGILState_STATE gilState = PyGILState_Ensure();
   PyObject *dataArgs = PyTuple_New(_numberArguments);
   if (_performAction != nullptr) {
     PyObject *pythonTime = PyFloat_FromDouble(time);
@@ -85,33 +98,10 @@ void PythonAction::performAction(double time,
     }
   }
 
-  if (_vertexCallback != nullptr) {
-    PyObject *      vertexArgs = PyTuple_New(3);
-    mesh::PtrMesh   mesh       = getMesh();
-    Eigen::VectorXd coords(mesh->getDimensions());
-    Eigen::VectorXd normal(mesh->getDimensions());
-    for (mesh::Vertex &vertex : mesh->vertices()) {
-      npy_intp vdim[]        = {mesh->getDimensions()};
-      int      id            = vertex.getID();
-      coords                 = vertex.getCoords();
-      normal                 = vertex.getNormal();
-      PyObject *pythonID     = PyInt_FromLong(id);
-      PyObject *pythonCoords = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, coords.data());
-      PyObject *pythonNormal = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, coords.data());
-      CHECK(pythonID != nullptr, "Creating python ID failed!");
-      CHECK(pythonCoords != nullptr, "Creating python coords failed!");
-      CHECK(pythonNormal != nullptr, "Creating python normal failed!");
-      PyTuple_SetItem(vertexArgs, 0, pythonID);
-      PyTuple_SetItem(vertexArgs, 1, pythonCoords);
-      PyTuple_SetItem(vertexArgs, 2, pythonNormal);
-      PyObject_CallObject(_vertexCallback, vertexArgs);
-      if (PyErr_Occurred()) {
-        PyErr_Print();
-        ERROR("Error occurred during call of function "
-              << "vertexCallback() python module \"" << _moduleName << "\"!");
-      }
-    }
-    Py_DECREF(vertexArgs);
+  if (_vertexBatchCallback != nullptr) {
+    callVertexBatchCallback();
+  } else if (_vertexCallback != nullptr) {
+    callVertexCallback();
   }
 
   if (_postAction != nullptr) {
@@ -126,13 +116,88 @@ void PythonAction::performAction(double time,
   }
 
   Py_DECREF(dataArgs);
+  PyGILState_Release(gilState);
+}
+
+void PythonAction::callVertexBatchCallback()
+{
+  // Vertices are stored one by one, hence their coordinates and normals are gathered into
+  // arrays allocated by NumPy. The arrays own their data, such that the module may keep them.
+  mesh::PtrMesh mesh = getMesh();
+  int dim = mesh->getDimensions();
+  int size = mesh->vertices().size();
+  npy_intp idsDim[]    = {size};
+  npy_intp coordsDim[] = {size, dim};
+  PyObject *pythonIDs     = PyArray_SimpleNew(1, idsDim, NPY_INT);
+  PyObject *pythonCoords  = PyArray_SimpleNew(2, coordsDim, NPY_DOUBLE);
+  PyObject *pythonNormals = PyArray_SimpleNew(2, coordsDim, NPY_DOUBLE);
+  CHECK(pythonIDs != nullptr, "Creating python IDs failed!");
+  CHECK(pythonCoords != nullptr, "Creating python coords failed!");
+  CHECK(pythonNormals != nullptr, "Creating python normals failed!");
+
+  using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  int *ids = static_cast<int *>(PyArray_DATA(reinterpret_cast<PyArrayObject *>(pythonIDs)));
+  Eigen::Map<RowMajorMatrix> coords(
+      static_cast<double *>(PyArray_DATA(reinterpret_cast<PyArrayObject *>(pythonCoords))), size, dim);
+  Eigen::Map<RowMajorMatrix> normals(
+      static_cast<double *>(PyArray_DATA(reinterpret_cast<PyArrayObject *>(pythonNormals))), size, dim);
+  for (int i = 0; i < size; i++) {
+    const mesh::Vertex &vertex = mesh->vertices()[i];
+    ids[i] = vertex.getID();
+    coords.row(i) = vertex.getCoords().transpose();
+    normals.row(i) = vertex.getNormal().transpose();
+  }
+
+  PyObject *vertexArgs = PyTuple_New(3);
+  PyTuple_SetItem(vertexArgs, 0, pythonIDs);
+  PyTuple_SetItem(vertexArgs, 1, pythonCoords);
+  PyTuple_SetItem(vertexArgs, 2, pythonNormals);
+  PyObject_CallObject(_vertexBatchCallback, vertexArgs);
+  if (PyErr_Occurred()) {
+    PyErr_Print();
+    ERROR("Error occurred during call of function "
+          << "vertexBatchCallback() python module \"" << _moduleName << "\"!");
+  }
+  Py_DECREF(vertexArgs);
+}
+
+void PythonAction::callVertexCallback()
+{
+  mesh::PtrMesh   mesh = getMesh();
+  Eigen::VectorXd coords(mesh->getDimensions());
+  Eigen::VectorXd normal(mesh->getDimensions());
+  for (mesh::Vertex &vertex : mesh->vertices()) {
+    npy_intp vdim[]        = {mesh->getDimensions()};
+    int      id            = vertex.getID();
+    coords                 = vertex.getCoords();
+    normal                 = vertex.getNormal();
+    PyObject *pythonID     = PyInt_FromLong(id);
+    PyObject *pythonCoords = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, coords.data());
+    PyObject *pythonNormal = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, normal.data());
+    CHECK(pythonID != nullptr, "Creating python ID failed!");
+    CHECK(pythonCoords != nullptr, "Creating python coords failed!");
+    CHECK(pythonNormal != nullptr, "Creating python normal failed!");
+    PyObject *vertexArgs = PyTuple_New(3);
+    PyTuple_SetItem(vertexArgs, 0, pythonID);
+    PyTuple_SetItem(vertexArgs, 1, pythonCoords);
+    PyTuple_SetItem(vertexArgs, 2, pythonNormal);
+    PyObject_CallObject(_vertexCallback, vertexArgs);
+    if (PyErr_Occurred()) {
+      PyErr_Print();
+      ERROR("Error occurred during call of function "
+            << "vertexCallback() python module \"" << _moduleName << "\"!");
+    }
+    Py_DECREF(vertexArgs);
+  }
 }
 
 void PythonAction::initialize()
 {
   assertion(not _isInitialized);
-  // Initialize Python
+  // Initialize Python, which does nothing if another action did so before
   Py_Initialize();
+  PyEval_InitThreads();
+  PyGILState_STATE gilState = PyGILState_Ensure();
   makeNumPyArraysAvailable();
   // Append execution path to find module to import
   PyRun_SimpleString("import sys");
@@ -157,12 +222,21 @@ void PythonAction::initialize()
   //  if (not valid){
   //  }
 
-  // Construct method vertexCallback
-  _vertexCallback = PyObject_GetAttrString(_module, "vertexCallback");
+  // Construct method vertexBatchCallback, which replaces vertexCallback if given
+  _vertexBatchCallback = PyObject_GetAttrString(_module, "vertexBatchCallback");
   if (PyErr_Occurred()) {
     PyErr_Clear();
-    WARN("No function void vertexCallback() in python module \"" << _moduleName << "\" found.");
-    _vertexCallback = nullptr;
+    _vertexBatchCallback = nullptr;
+  }
+
+  // Construct method vertexCallback
+  if (_vertexBatchCallback == nullptr) {
+    _vertexCallback = PyObject_GetAttrString(_module, "vertexCallback");
+    if (PyErr_Occurred()) {
+      PyErr_Clear();
+      WARN("No function void vertexCallback() in python module \"" << _moduleName << "\" found.");
+      _vertexCallback = nullptr;
+    }
   }
 
   // Construct function postAction
@@ -172,6 +246,13 @@ void PythonAction::initialize()
     WARN("No function void postAction() in python module \"" << _moduleName << "\" found.");
     _postAction = nullptr;
   }
+  PyGILState_Release(gilState);
+
+  // Let threads of Python modules run while not performing actions
+  if (_releaseGIL and releasedThreadState == nullptr) {
+    releasedThreadState = PyEval_SaveThread();
+  }
+  _isInitialized = true;
 }
 
 int PythonAction::makeNumPyArraysAvailable()
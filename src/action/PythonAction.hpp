@@ -14,17 +14,29 @@ namespace precice
 namespace action
 {
 
-/// Action whose implementation is given in a Python file.
+/**
+ * @brief Action whose implementation is given in a Python file.
+ *
+ * If the module defines vertexBatchCallback(ids, coords, normals), it is called once with the
+ * IDs, coordinates and normals of all vertices, instead of calling vertexCallback() per vertex.
+ */
 class PythonAction : public Action
 {
 public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] releaseGIL If true, the Python global interpreter lock is released between
+   *            actions, such that threads started by the module run while the solver computes.
+   */
   PythonAction(
       Timing               timing,
       const std::string &  modulePath,
       const std::string &  moduleName,
       const mesh::PtrMesh &mesh,
       int                  targetDataID,
-      int                  sourceDataID);
+      int                  sourceDataID,
+      bool                 releaseGIL = false);
 
   virtual ~PythonAction();
 
@@ -47,6 +59,8 @@ private:
 
   int _numberArguments = 2;
 
+  bool _releaseGIL;
+
   bool _isInitialized = false;
 
   PyObject *_moduleNameObject = nullptr;
@@ -61,10 +75,18 @@ private:
 
   PyObject *_vertexCallback = nullptr;
 
+  PyObject *_vertexBatchCallback = nullptr;
+
   PyObject *_postAction = nullptr; 
 
   void initialize();
 
+  /// Calls vertexBatchCallback() once for all vertices of the mesh.
+  void callVertexBatchCallback();
+
+  /// Calls vertexCallback() for every vertex of the mesh.
+  void callVertexCallback();
+
   int makeNumPyArraysAvailable();
 };
 
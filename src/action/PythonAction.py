@@ -26,6 +26,17 @@ def vertexCallback(id, coords, normal):
     global myTargetData
     # myTargetData[id] += coords[0] + mySourceData[id] # Add data to vertex coords
     
+def vertexBatchCallback(ids, coords, normals):
+    '''If defined, this function is called instead of vertexCallback, once for all
+    vertices of the configured mesh. Its parameters are a 1D array of vertex IDs and 2D
+    arrays of coordinates and normals, with one row per vertex. The arrays hold copies,
+    i.e., modifying them does not change the mesh, and they may be kept beyond the call.'''
+
+    # Usage example:
+    global mySourceData
+    global myTargetData
+    # myTargetData[ids] += coords[:, 0] + mySourceData[ids] # Add data to vertex coords
+    
 def postAction():
     '''This function is called at last, if not omitted.'''
     
@@ -42,6 +42,7 @@ ActionConfiguration:: ActionConfiguration
   ATTR_NAME ( "name" ),
   ATTR_VALUE ( "value" ),
   ATTR_MESH ( "mesh" ),
+  ATTR_RELEASE_GIL ( "release-gil" ),
   VALUE_REGULAR_PRIOR ( "regular-prior" ),
   VALUE_REGULAR_POST ( "regular-post" ),
   VALUE_ON_EXCHANGE_PRIOR ( "on-exchange-prior" ),
@@ -157,6 +158,12 @@ ActionConfiguration:: ActionConfiguration
     tagOptionalTargetData.addAttribute(attrName);
     tag.addSubtag(tagOptionalSourceData);
     tag.addSubtag(tagOptionalTargetData);
+    XMLAttribute<bool> attrReleaseGIL(ATTR_RELEASE_GIL);
+    attrReleaseGIL.setDefaultValue(false);
+    doc = "If on, the Python global interpreter lock is released between actions, ";
+    doc += "such that threads started by the Python module run while the solver computes.";
+    attrReleaseGIL.setDocumentation(doc);
+    tag.addAttribute(attrReleaseGIL);
     tags.push_back(tag);
   }
 
@@ -191,6 +198,9 @@ void ActionConfiguration:: xmlTagCallback
     _configuredAction.type = callingTag.getName();
     _configuredAction.timing = callingTag.getStringAttributeValue(ATTR_TIMING);
     _configuredAction.mesh = callingTag.getStringAttributeValue(ATTR_MESH);
+    if (_configuredAction.type == NAME_PYTHON){
+      _configuredAction.releaseGIL = callingTag.getBooleanAttributeValue(ATTR_RELEASE_GIL);
+    }
     //addSubtags ( callingTag, _configured.type );
   }
   else if (callingTag.getName() == TAG_SOURCE_DATA){
@@ -325,7 +335,7 @@ void ActionConfiguration:: createAction()
   else if ( _configuredAction.type == NAME_PYTHON ){
     action = action::PtrAction (
         new action::PythonAction(timing, _configuredAction.path, _configuredAction.module,
-        mesh, targetDataID, sourceDataID) );
+        mesh, targetDataID, sourceDataID, _configuredAction.releaseGIL) );
   }
   #endif
   assertion(action.get() != nullptr);
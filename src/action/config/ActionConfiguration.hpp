@@ -89,10 +89,12 @@ private:
     int maxIterations;
     std::string path;
     std::string module;
+    bool releaseGIL;
 
     ConfiguredAction ()
     : type (), timing(), sourceData(), targetData(), mesh(),
-      convergenceTolerance(0.0), maxIterations(0), path(), module()
+      convergenceTolerance(0.0), maxIterations(0), path(), module(),
+      releaseGIL(false)
     {}
   };
 
@@ -122,6 +124,7 @@ private:
   const std::string ATTR_NAME;
   const std::string ATTR_VALUE;
   const std::string ATTR_MESH;
+  const std::string ATTR_RELEASE_GIL;
 
   const std::string VALUE_REGULAR_PRIOR;
   const std::string VALUE_REGULAR_POST;
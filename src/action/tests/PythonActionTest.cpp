@@ -33,6 +33,21 @@ BOOST_AUTO_TEST_CASE(AllMethods)
   BOOST_TEST(testing::equals(mesh->data(targetID)->values(), result));
 }
 
+BOOST_AUTO_TEST_CASE(VertexBatchCallback)
+{
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, false));
+  mesh->createVertex(Eigen::Vector2d(1.0, 0.0)).setNormal(Eigen::Vector2d(0.0, 0.1));
+  mesh->createVertex(Eigen::Vector2d(2.0, 0.0)).setNormal(Eigen::Vector2d(0.0, 0.2));
+  mesh->createVertex(Eigen::Vector2d(3.0, 0.0)).setNormal(Eigen::Vector2d(0.0, 0.3));
+  int targetID = mesh->createData("TargetData", 1)->getID();
+  mesh->allocateDataValues();
+  std::string path = testing::getPathToSources() + "/action/tests/";
+  PythonAction action(PythonAction::ALWAYS_PRIOR, path, "TestBatchAction", mesh, targetID, -1, true);
+  action.performAction(0.0, 0.0, 0.0, 0.0);
+  Eigen::Vector3d result(1.1, 2.2, 3.3);
+  BOOST_TEST(testing::equals(mesh->data(targetID)->values(), result));
+}
+
 BOOST_AUTO_TEST_CASE(OmitMethods)
 {
   std::string path = testing::getPathToSources() + "/action/tests/";
@@ -0,0 +1,13 @@
+myTargetData = 0
+
+def performAction(time, dt, targetData):
+    global myTargetData
+    myTargetData = targetData # store (reference to) targetData for later use
+
+#
+# This function is called once with the IDs, coordinates and normals of all
+# vertices, instead of vertexCallback.
+#
+def vertexBatchCallback(ids, coords, normals):
+    global myTargetData
+    myTargetData[ids] = coords[:, 0] + normals[:, 1]
@@ -1,5 +1,6 @@
 #include "CommunicateBoundingBox.hpp"
 #include "Communication.hpp"
+#include <vector>
 
 namespace precice
 {
@@ -16,11 +17,9 @@ void CommunicateBoundingBox::sendBoundingBox(
     int                            rankReceiver)
 {
   TRACE(rankReceiver);
-
-  for (const auto &d : bb) {
-    _communication->send(d.first, rankReceiver);
-    _communication->send(d.second, rankReceiver);
-  }
+  std::vector<double> packet;
+  pack(bb, packet);
+  _communication->send(packet.data(), packet.size(), rankReceiver);
 }
 
 void CommunicateBoundingBox::receiveBoundingBox(
@@ -28,11 +27,10 @@ void CommunicateBoundingBox::receiveBoundingBox(
     int                      rankSender)
 {
   TRACE(rankSender);
-
-  for (auto &d : bb) {
-    _communication->receive(d.first, rankSender);
-    _communication->receive(d.second, rankSender);
-  }
+  std::vector<double> packet(2 * bb.size());
+  _communication->receive(packet.data(), packet.size(), rankSender);
+  auto packed = packet.cbegin();
+  unpack(packed, bb);
 }
 
 void CommunicateBoundingBox::sendBoundingBoxMap(
@@ -40,10 +38,11 @@ void CommunicateBoundingBox::sendBoundingBoxMap(
     int                         rankReceiver)
 {
   TRACE(rankReceiver);
-
+  std::vector<double> packet;
   for (const auto &bb : bbm) {
-    sendBoundingBox(bb.second, rankReceiver);
+    pack(bb.second, packet);
   }
+  _communication->send(packet.data(), packet.size(), rankReceiver);
 }
 
 void CommunicateBoundingBox::receiveBoundingBoxMap(
@@ -51,33 +50,65 @@ void CommunicateBoundingBox::receiveBoundingBoxMap(
     int                         rankSender)
 {
   TRACE(rankSender);
-
+  std::vector<double> packet(packetSize(bbm));
+  _communication->receive(packet.data(), packet.size(), rankSender);
+  auto packed = packet.cbegin();
   for (auto &bb : bbm) {
-    receiveBoundingBox(bb.second, rankSender);
+    unpack(packed, bb.second);
   }
 }
 
 void CommunicateBoundingBox::broadcastSendBoundingBoxMap(
     mesh::Mesh::BoundingBoxMap &bbm)
 {
-
-  for (const auto &rank : bbm) {
-    for (const auto &dimension : rank.second) {
-      _communication->broadcast(dimension.first);
-      _communication->broadcast(dimension.second);
-    }
+  TRACE();
+  std::vector<double> packet;
+  for (const auto &bb : bbm) {
+    pack(bb.second, packet);
   }
+  _communication->broadcast(packet.data(), packet.size());
 }
 
 void CommunicateBoundingBox::broadcastReceiveBoundingBoxMap(
     mesh::Mesh::BoundingBoxMap &bbm)
 {
-  for (auto &rank : bbm) {
-    for (auto &dimension : rank.second) {
-      _communication->broadcast(dimension.first, 0);
-      _communication->broadcast(dimension.second, 0);
-    }
+  TRACE();
+  std::vector<double> packet(packetSize(bbm));
+  _communication->broadcast(packet.data(), packet.size(), 0);
+  auto packed = packet.cbegin();
+  for (auto &bb : bbm) {
+    unpack(packed, bb.second);
+  }
+}
+
+void CommunicateBoundingBox::pack(
+    const mesh::Mesh::BoundingBox &bb,
+    std::vector<double> &          packet)
+{
+  for (const auto &d : bb) {
+    packet.push_back(d.first);
+    packet.push_back(d.second);
+  }
+}
+
+void CommunicateBoundingBox::unpack(
+    std::vector<double>::const_iterator &packed,
+    mesh::Mesh::BoundingBox &            bb)
+{
+  for (auto &d : bb) {
+    d.first  = *packed++;
+    d.second = *packed++;
+  }
+}
+
+size_t CommunicateBoundingBox::packetSize(
+    const mesh::Mesh::BoundingBoxMap &bbm)
+{
+  size_t size = 0;
+  for (const auto &bb : bbm) {
+    size += 2 * bb.second.size();
   }
+  return size;
 }
 
 } // namespace com
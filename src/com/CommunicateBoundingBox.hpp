@@ -2,13 +2,19 @@
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/Mesh.hpp"
+#include <vector>
 
 namespace precice
 {
 namespace com
 {
 
-/// Copies either a bounding box around a mesh partition or complete maps of bounding boxes from a sender to a receiver.
+/**
+ * @brief Copies either a bounding box around a mesh partition or complete maps of bounding boxes from a sender to a receiver.
+ *
+ * The receiver passes boxes (or maps of boxes) of the right size. All their bounds are packed
+ * into one message, in the order of the dimensions and ranks.
+ */
 class CommunicateBoundingBox
 {
 public:
@@ -43,6 +49,20 @@ private:
 
   /// Communication means used for the transfer of the geometry.
   com::PtrCommunication _communication;
+
+  /// Appends the lower and upper bounds of all dimensions to the packet.
+  static void pack(
+      const mesh::Mesh::BoundingBox &bb,
+      std::vector<double> &          packet);
+
+  /// Reads the bounds of all dimensions of bb from the packet, advancing packed.
+  static void unpack(
+      std::vector<double>::const_iterator &packed,
+      mesh::Mesh::BoundingBox &            bb);
+
+  /// Returns the number of bounds of all boxes in the map.
+  static size_t packetSize(
+      const mesh::Mesh::BoundingBoxMap &bbm);
 };
 } // namespace com
 } // namespace precice
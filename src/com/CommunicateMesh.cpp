@@ -1,6 +1,8 @@
 #include "CommunicateMesh.hpp"
+#include <algorithm>
 #include <map>
 #include <vector>
+#include "CommunicateBoundingBox.hpp"
 #include "Communication.hpp"
 #include "com/SharedPointer.hpp"
 #include "mesh/Edge.hpp"
@@ -12,10 +14,25 @@ namespace precice
 {
 namespace com
 {
+namespace
+{
+/// Entries of the header, which leads the integer section of a mesh packet.
+enum HeaderEntry {
+  NUMBER_OF_VERTICES,
+  NUMBER_OF_EDGES,
+  NUMBER_OF_TRIANGLES,
+  VERTICES_PER_MESSAGE,
+  HEADER_SIZE
+};
+} // namespace
+
 CommunicateMesh::CommunicateMesh(
-    com::PtrCommunication communication)
-    : _communication(communication)
+    com::PtrCommunication communication,
+    int                   verticesPerMessage)
+    : _communication(communication),
+      _verticesPerMessage(verticesPerMessage)
 {
+  assertion(verticesPerMessage >= 0, verticesPerMessage);
 }
 
 void CommunicateMesh::sendMesh(
@@ -23,62 +40,15 @@ void CommunicateMesh::sendMesh(
     int               rankReceiver)
 {
   TRACE(mesh.getName(), rankReceiver);
-  int dim = mesh.getDimensions();
-
-  int numberOfVertices = mesh.vertices().size();
-  _communication->send(numberOfVertices, rankReceiver);
-  if (not mesh.vertices().empty()) {
-    std::vector<double> coords(numberOfVertices * dim);
-    std::vector<int> globalIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
-      globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
-    }
-    _communication->send(coords, rankReceiver);
-    _communication->send(globalIDs, rankReceiver);
-  }
-
-  int numberOfEdges = mesh.edges().size();
-  _communication->send(numberOfEdges, rankReceiver);
-  if (not mesh.edges().empty()) {
-    //we need to send the vertexIDs first such that the right edges can be created later
-    //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = mesh.vertices()[i].getID();
-    }
-    _communication->send(vertexIDs, rankReceiver);
-
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
-    }
-    _communication->send(edgeIDs, rankReceiver);
-  }
-
-  if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->send(numberOfTriangles, rankReceiver);
-    if (not mesh.triangles().empty()) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->send(edgeIDs, rankReceiver);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
-      }
-      _communication->send(triangleIDs, rankReceiver);
-    }
+  std::vector<int> ids;
+  packIDs(mesh, ids);
+  _communication->send(ids, rankReceiver);
+
+  std::vector<double> coords;
+  int numberOfVertices = ids[NUMBER_OF_VERTICES];
+  for (int begin = 0; begin < numberOfVertices; begin += ids[VERTICES_PER_MESSAGE]) {
+    packCoords(mesh, begin, ids[VERTICES_PER_MESSAGE], coords);
+    _communication->send(coords.data(), coords.size(), rankReceiver);
   }
 }
 
@@ -87,245 +57,198 @@ void CommunicateMesh::receiveMesh(
     int         rankSender)
 {
   TRACE(mesh.getName(), rankSender);
-  int dim = mesh.getDimensions();
-
-  std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
-  int                           numberOfVertices = 0;
-  _communication->receive(numberOfVertices, rankSender);
-  DEBUG("Number of vertices to receive: " << numberOfVertices);
-
-  if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int> globalIDs;
-    _communication->receive(vertexCoords, rankSender);
-    _communication->receive(globalIDs, rankSender);
-    for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      assertion(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
-    }
+  std::vector<int> ids;
+  _communication->receive(ids, rankSender);
+  assertion(ids.size() >= HEADER_SIZE, ids.size());
+  DEBUG("Number of vertices to receive: " << ids[NUMBER_OF_VERTICES]);
+
+  int firstVertex = mesh.vertices().size();
+  std::vector<double> coords;
+  int numberOfVertices = ids[NUMBER_OF_VERTICES];
+  for (int begin = 0; begin < numberOfVertices; begin += ids[VERTICES_PER_MESSAGE]) {
+    coords.resize(std::min(ids[VERTICES_PER_MESSAGE], numberOfVertices - begin) * mesh.getDimensions());
+    _communication->receive(coords.data(), coords.size(), rankSender);
+    unpackVertices(coords, ids, begin, mesh);
   }
+  unpackConnectivity(ids, firstVertex, mesh);
+}
 
-  int                       numberOfEdges = 0;
-  std::vector<mesh::Edge *> edges;
-  _communication->receive(numberOfEdges, rankSender);
-  DEBUG("Number of edges to receive: " << numberOfEdges);
-  if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->receive(vertexIDs, rankSender);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
-    }
-
-    std::vector<int> edgeIDs;
-    _communication->receive(edgeIDs, rankSender);
-    for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
-      assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
-    }
+void CommunicateMesh::broadcastSendMesh(const mesh::Mesh &mesh)
+{
+  TRACE(mesh.getName());
+  std::vector<int> ids;
+  packIDs(mesh, ids);
+  _communication->broadcast(ids);
+
+  std::vector<double> coords;
+  int numberOfVertices = ids[NUMBER_OF_VERTICES];
+  for (int begin = 0; begin < numberOfVertices; begin += ids[VERTICES_PER_MESSAGE]) {
+    packCoords(mesh, begin, ids[VERTICES_PER_MESSAGE], coords);
+    _communication->broadcast(coords.data(), coords.size());
   }
+}
 
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->receive(numberOfTriangles, rankSender);
-    DEBUG("Number of Triangles to receive: " << numberOfTriangles);
-    DEBUG("Number of Edges: " << edges.size());
-    if (numberOfTriangles > 0) {
-      assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->receive(edgeIDs, rankSender);
-      std::map<int, mesh::Edge *> edgeMap;
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
+void CommunicateMesh::broadcastReceiveMesh(
+    mesh::Mesh &mesh)
+{
+  TRACE(mesh.getName());
+  int rankBroadcaster = 0;
+  std::vector<int> ids;
+  _communication->broadcast(ids, rankBroadcaster);
+  assertion(ids.size() >= HEADER_SIZE, ids.size());
+
+  int firstVertex = mesh.vertices().size();
+  std::vector<double> coords;
+  int numberOfVertices = ids[NUMBER_OF_VERTICES];
+  for (int begin = 0; begin < numberOfVertices; begin += ids[VERTICES_PER_MESSAGE]) {
+    coords.resize(std::min(ids[VERTICES_PER_MESSAGE], numberOfVertices - begin) * mesh.getDimensions());
+    _communication->broadcast(coords.data(), coords.size(), rankBroadcaster);
+    unpackVertices(coords, ids, begin, mesh);
+  }
+  unpackConnectivity(ids, firstVertex, mesh);
+}
 
-      std::vector<int> triangleIDs;
-      _communication->receive(triangleIDs, rankSender);
+void CommunicateMesh::sendBoundingBox(
+    const mesh::Mesh::BoundingBox &bb,
+    int                            rankReceiver)
+{
+  TRACE(rankReceiver);
+  CommunicateBoundingBox(_communication).sendBoundingBox(bb, rankReceiver);
+}
 
-      for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
-        assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
-    }
-  }
+void CommunicateMesh::receiveBoundingBox(
+    mesh::Mesh::BoundingBox &bb,
+    int                      rankSender)
+{
+  TRACE(rankSender);
+  CommunicateBoundingBox(_communication).receiveBoundingBox(bb, rankSender);
 }
 
-void CommunicateMesh::broadcastSendMesh(const mesh::Mesh &mesh)
+void CommunicateMesh::packIDs(
+    const mesh::Mesh &mesh,
+    std::vector<int> &ids) const
 {
-  TRACE(mesh.getName());
-  int dim = mesh.getDimensions();
+  int numberOfVertices  = mesh.vertices().size();
+  int numberOfEdges     = mesh.edges().size();
+  int numberOfTriangles = mesh.triangles().size();
+  int verticesPerMessage = _verticesPerMessage;
+  if (verticesPerMessage == 0) {
+    verticesPerMessage = std::max(numberOfVertices, 1);
+  }
 
-  int numberOfVertices = mesh.vertices().size();
-  _communication->broadcast(numberOfVertices);
-  if (numberOfVertices > 0) {
-    std::vector<double> coords(numberOfVertices * dim);
-    std::vector<int> globalIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
-      globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
-    }
-    _communication->broadcast(coords);
-    _communication->broadcast(globalIDs);
+  ids.reserve(HEADER_SIZE + numberOfVertices * 2 + numberOfEdges * 3 + numberOfTriangles * 3);
+  ids.assign({numberOfVertices, numberOfEdges, numberOfTriangles, verticesPerMessage});
+  for (const mesh::Vertex &vertex : mesh.vertices()) {
+    ids.push_back(vertex.getGlobalIndex());
   }
 
-  int numberOfEdges = mesh.edges().size();
-  _communication->broadcast(numberOfEdges);
   if (numberOfEdges > 0) {
     //we need to send the vertexIDs first such that the right edges can be created later
     //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = mesh.vertices()[i].getID();
+    for (const mesh::Vertex &vertex : mesh.vertices()) {
+      ids.push_back(vertex.getID());
     }
-    _communication->broadcast(vertexIDs);
-
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
+    for (const mesh::Edge &edge : mesh.edges()) {
+      ids.push_back(edge.vertex(0).getID());
+      ids.push_back(edge.vertex(1).getID());
     }
-    _communication->broadcast(edgeIDs);
   }
 
-  if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->broadcast(numberOfTriangles);
-    if (numberOfTriangles > 0) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->broadcast(edgeIDs, numberOfEdges);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
-      }
-      _communication->broadcast(triangleIDs);
+  if (numberOfTriangles > 0) {
+    //we need to send the edgeIDs first such that the right triangles can be created later
+    for (const mesh::Edge &edge : mesh.edges()) {
+      ids.push_back(edge.getID());
+    }
+    for (const mesh::Triangle &triangle : mesh.triangles()) {
+      ids.push_back(triangle.edge(0).getID());
+      ids.push_back(triangle.edge(1).getID());
+      ids.push_back(triangle.edge(2).getID());
     }
   }
 }
 
-void CommunicateMesh::broadcastReceiveMesh(
-    mesh::Mesh &mesh)
+void CommunicateMesh::packCoords(
+    const mesh::Mesh &   mesh,
+    int                  begin,
+    int                  count,
+    std::vector<double> &coords)
 {
-  TRACE(mesh.getName());
-  int dim             = mesh.getDimensions();
-  int rankBroadcaster = 0;
-
-  std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
-  int                           numberOfVertices = 0;
-  _communication->broadcast(numberOfVertices, rankBroadcaster);
-
-  if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int> globalIDs;
-    _communication->broadcast(vertexCoords, rankBroadcaster);
-    _communication->broadcast(globalIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      assertion(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
+  int dim = mesh.getDimensions();
+  int end = std::min(begin + count, (int) mesh.vertices().size());
+  coords.resize((end - begin) * dim);
+  for (int i = begin; i < end; i++) {
+    const mesh::Vertex::RawCoords &vertexCoords = mesh.vertices()[i].getCoords();
+    for (int d = 0; d < dim; d++) {
+      coords[(i - begin) * dim + d] = vertexCoords[d];
     }
   }
+}
 
-  int                       numberOfEdges = 0;
-  std::vector<mesh::Edge *> edges;
-  _communication->broadcast(numberOfEdges, rankBroadcaster);
+void CommunicateMesh::unpackVertices(
+    const std::vector<double> &coords,
+    const std::vector<int> &   ids,
+    int                        begin,
+    mesh::Mesh &               mesh)
+{
+  int dim   = mesh.getDimensions();
+  int count = coords.size() / dim;
+  const int *globalIDs = ids.data() + HEADER_SIZE;
+  for (int i = 0; i < count; i++) {
+    mesh::Vertex &v = mesh.createVertex(Eigen::Map<const Eigen::VectorXd>(&coords[i * dim], dim));
+    assertion(v.getID() >= 0, v.getID());
+    v.setGlobalIndex(globalIDs[begin + i]);
+  }
+}
+
+void CommunicateMesh::unpackConnectivity(
+    const std::vector<int> &ids,
+    int                     firstVertex,
+    mesh::Mesh &            mesh)
+{
+  int numberOfVertices  = ids[NUMBER_OF_VERTICES];
+  int numberOfEdges     = ids[NUMBER_OF_EDGES];
+  int numberOfTriangles = ids[NUMBER_OF_TRIANGLES];
+  DEBUG("Number of edges to receive: " << numberOfEdges);
+  DEBUG("Number of triangles to receive: " << numberOfTriangles);
+  const int *section = ids.data() + HEADER_SIZE + numberOfVertices;
+
+  int firstEdge = mesh.edges().size();
   if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->broadcast(vertexIDs, rankBroadcaster);
+    std::map<int, mesh::Vertex *> vertexMap;
     for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
+      vertexMap[section[i]] = &mesh.vertices()[firstVertex + i];
     }
+    section += numberOfVertices;
 
-    std::vector<int> edgeIDs;
-    _communication->broadcast(edgeIDs, rankBroadcaster);
     for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
-      assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
+      assertion(vertexMap.find(section[i * 2]) != vertexMap.end());
+      assertion(vertexMap.find(section[i * 2 + 1]) != vertexMap.end());
+      assertion(section[i * 2] != section[i * 2 + 1]);
+      mesh.createEdge(*vertexMap[section[i * 2]], *vertexMap[section[i * 2 + 1]]);
     }
+    section += numberOfEdges * 2;
   }
 
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->broadcast(numberOfTriangles, rankBroadcaster);
-    if (numberOfTriangles > 0) {
-      assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->broadcast(edgeIDs, rankBroadcaster);
-      std::map<int, mesh::Edge *> edgeMap;
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
-
-      std::vector<int> triangleIDs;
-      _communication->broadcast(triangleIDs, rankBroadcaster);
-
-      for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
-        assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
+  if (numberOfTriangles > 0) {
+    assertion(numberOfEdges > 0);
+    std::map<int, mesh::Edge *> edgeMap;
+    for (int i = 0; i < numberOfEdges; i++) {
+      edgeMap[section[i]] = &mesh.edges()[firstEdge + i];
     }
-  }
-}
+    section += numberOfEdges;
 
-void CommunicateMesh::sendBoundingBox(
-    const mesh::Mesh::BoundingBox &bb,
-    int                            rankReceiver)
-{
-  TRACE(rankReceiver);
-  int dim = bb.size();
-  for (int d = 0; d < dim; d++) {
-    _communication->send(bb[d].first, rankReceiver);
-    _communication->send(bb[d].second, rankReceiver);
-  }
-}
-
-void CommunicateMesh::receiveBoundingBox(
-    mesh::Mesh::BoundingBox &bb,
-    int                      rankSender)
-{
-  TRACE(rankSender);
-  int dim = bb.size();
-  for (int d = 0; d < dim; d++) {
-    _communication->receive(bb[d].first, rankSender);
-    _communication->receive(bb[d].second, rankSender);
+    for (int i = 0; i < numberOfTriangles; i++) {
+      assertion(edgeMap.find(section[i * 3]) != edgeMap.end());
+      assertion(edgeMap.find(section[i * 3 + 1]) != edgeMap.end());
+      assertion(edgeMap.find(section[i * 3 + 2]) != edgeMap.end());
+      assertion(section[i * 3] != section[i * 3 + 1]);
+      assertion(section[i * 3 + 1] != section[i * 3 + 2]);
+      assertion(section[i * 3 + 2] != section[i * 3]);
+      mesh.createTriangle(*edgeMap[section[i * 3]], *edgeMap[section[i * 3 + 1]], *edgeMap[section[i * 3 + 2]]);
+    }
+    section += numberOfTriangles * 3;
   }
+  assertion(section == ids.data() + ids.size());
 }
 } // namespace com
 } // namespace precice
@@ -3,19 +3,33 @@
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/Mesh.hpp"
+#include <vector>
 
 namespace precice
 {
 namespace com
 {
 
-/// Copies a Mesh object from a sender to a receiver.
+/**
+ * @brief Copies a Mesh object from a sender to a receiver.
+ *
+ * A mesh is sent as one integer message, holding a header with the numbers of vertices, edges
+ * and triangles followed by all global indices and connectivity IDs, and the vertex
+ * coordinates. The coordinates go out in one message or, to bound the buffers needed for
+ * huge meshes, in chunks of a fixed number of vertices.
+ */
 class CommunicateMesh
 {
 public:
-  /// Constructor, takes communication to be used in transfer.
+  /**
+   * @brief Constructor, takes communication to be used in transfer.
+   *
+   * @param[in] verticesPerMessage Maximum number of vertices whose coordinates are sent in
+   *            one message, 0 sends all of them at once. Only relevant for the sender.
+   */
   explicit CommunicateMesh(
-      com::PtrCommunication communication);
+      com::PtrCommunication communication,
+      int                   verticesPerMessage = 0);
 
   /// Sends a constructed mesh to the receiver with given rank.
   void sendMesh(
@@ -46,6 +60,33 @@ private:
   
   /// Communication means used for the transfer of the geometry.
   com::PtrCommunication _communication;
+
+  int _verticesPerMessage;
+
+  /// Writes header, global indices and connectivity of the mesh into ids.
+  void packIDs(
+      const mesh::Mesh &mesh,
+      std::vector<int> &ids) const;
+
+  /// Writes the coordinates of at most count vertices, starting at vertex begin, into coords.
+  static void packCoords(
+      const mesh::Mesh &   mesh,
+      int                  begin,
+      int                  count,
+      std::vector<double> &coords);
+
+  /// Creates the received vertices starting at vertex begin of the packet.
+  static void unpackVertices(
+      const std::vector<double> &coords,
+      const std::vector<int> &   ids,
+      int                        begin,
+      mesh::Mesh &               mesh);
+
+  /// Creates edges and triangles between the received vertices, starting at vertex firstVertex of mesh.
+  void unpackConnectivity(
+      const std::vector<int> &ids,
+      int                     firstVertex,
+      mesh::Mesh &            mesh);
 };
 } // namespace com
 } // namespace precice
@@ -1,27 +1,72 @@
 #include "Communication.hpp"
+#include <algorithm>
+#include <vector>
 #include "Request.hpp"
 
 namespace precice
 {
 namespace com
 {
-/**
- * @attention This method modifies the input buffer.
- */
+
+namespace
+{
+/// Upper bound for the number of values buffered by receiveSum(), i.e., 8 MB of doubles
+const int maxBufferedValues = 1 << 20;
+} // namespace
+
+void Communication::receiveSum(double *itemsToReceive, int size)
+{
+  TRACE(size);
+  int ranks = getRemoteCommunicatorSize();
+  if (ranks == 0)
+    return;
+
+  // Receives from several ranks are in flight at once, such that the master
+  // does not wait for every rank one after another. The contributions are
+  // still added in rank order, which keeps the sum deterministic.
+  int window = std::max(1, std::min(ranks, maxBufferedValues / std::max(size, 1)));
+  std::vector<std::vector<double>> buffers(window, std::vector<double>(size));
+  std::vector<PtrRequest>          requests(window);
+
+  for (int rank = 0; rank < window; ++rank) {
+    requests[rank] = aReceive(buffers[rank].data(), size, rank + _rankOffset);
+  }
+  for (int rank = 0; rank < ranks; ++rank) {
+    int slot = rank % window;
+    requests[slot]->wait();
+    for (int i = 0; i < size; i++) {
+      itemsToReceive[i] += buffers[slot][i];
+    }
+    if (rank + window < ranks) {
+      requests[slot] = aReceive(buffers[slot].data(), size, rank + window + _rankOffset);
+    }
+  }
+}
+
+int Communication::receiveSum(int itemToReceive)
+{
+  TRACE();
+  int ranks = getRemoteCommunicatorSize();
+  std::vector<int>        items(ranks);
+  std::vector<PtrRequest> requests(ranks);
+  for (int rank = 0; rank < ranks; ++rank) {
+    requests[rank] = aReceive(items[rank], rank + _rankOffset);
+  }
+  Request::wait(requests);
+  for (int item : items) {
+    itemToReceive += item;
+  }
+  return itemToReceive;
+}
+
 void Communication::reduceSum(double *itemsToSend, double *itemsToReceive, int size)
 {
   TRACE(size);
 
   std::copy(itemsToSend, itemsToSend + size, itemsToReceive);
-  
+
   // receive local results from slaves
-  for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
-    auto request = aReceive(itemsToSend, size, rank + _rankOffset);
-    request->wait();
-    for (int i = 0; i < size; i++) {
-      itemsToReceive[i] += itemsToSend[i];
-    }
-  }
+  receiveSum(itemsToReceive, size);
 }
 
 void Communication::reduceSum(double *itemsToSend, double *itemsToReceive, int size, int rankMaster)
@@ -36,14 +81,8 @@ void Communication::reduceSum(int itemToSend, int &itemToReceive)
 {
   TRACE();
 
-  itemToReceive = itemToSend;
-
   // receive local results from slaves
-  for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
-    auto request = aReceive(itemToSend, rank + _rankOffset);
-    request->wait();
-    itemToReceive += itemToSend;
-  }
+  itemToReceive = receiveSum(itemToSend);
 }
 
 void Communication::reduceSum(int itemToSend, int &itemToReceive, int rankMaster)
@@ -54,23 +93,14 @@ void Communication::reduceSum(int itemToSend, int &itemToReceive, int rankMaster
   request->wait();
 }
 
-/**
- * @attention This method modifies the input buffer.
- */
 void Communication::allreduceSum(double *itemsToSend, double *itemsToReceive, int size)
 {
   TRACE(size);
 
   std::copy(itemsToSend, itemsToSend + size, itemsToReceive);
-  
+
   // receive local results from slaves
-  for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
-    auto request = aReceive(itemsToSend, size, rank + _rankOffset);
-    request->wait();
-    for (int i = 0; i < size; i++) {
-      itemsToReceive[i] += itemsToSend[i];
-    }
-  }
+  receiveSum(itemsToReceive, size);
 
   // send reduced result to all slaves
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
@@ -101,11 +131,7 @@ void Communication::allreduceSum(double itemToSend, double &itemToReceive)
   itemToReceive = itemToSend;
 
   // receive local results from slaves
-  for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
-    auto request = aReceive(&itemToSend, 1, rank + _rankOffset);
-    request->wait();
-    itemToReceive += itemToSend;
-  }
+  receiveSum(&itemToReceive, 1);
 
   // send reduced result to all slaves
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
@@ -130,14 +156,8 @@ void Communication::allreduceSum(int itemToSend, int &itemToReceive)
 {
   TRACE();
 
-  itemToReceive = itemToSend;
-
   // receive local results from slaves
-  for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
-    auto request = aReceive(itemToSend, rank + _rankOffset);
-    request->wait();
-    itemToReceive += itemToSend;
-  }
+  itemToReceive = receiveSum(itemToSend);
 
   // send reduced result to all slaves
   std::vector<PtrRequest> requests(getRemoteCommunicatorSize());
@@ -275,6 +275,16 @@ protected:
 
   bool _isConnected = false;
 
+  /**
+   * @brief Receives size values from every remote rank and adds them to itemsToReceive.
+   *
+   * Several receives are posted at once and added in the order of the ranks.
+   */
+  void receiveSum(double *itemsToReceive, int size);
+
+  /// Receives one value from every remote rank and returns their sum plus itemToReceive.
+  int receiveSum(int itemToReceive);
+
 private:
   logging::Logger _log{"com::Communication"};
   
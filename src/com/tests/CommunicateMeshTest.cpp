@@ -5,6 +5,7 @@
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/PropertyContainer.hpp"
+#include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "testing/Testing.hpp"
 #include "utils/Parallel.hpp"
@@ -82,6 +83,74 @@ BOOST_AUTO_TEST_CASE(twoSolvers,
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(ChunkedTriangles,
+                     * testing::MinRanks(2))
+{
+  utils::Parallel::synchronizeProcesses();
+  mesh::PropertyContainer::resetPropertyIDCounter();
+
+  std::string participant0("rank0");
+  std::string participant1("rank1");
+
+  // Build mesh to communicate for rank0
+  mesh::Mesh mesh("MyMesh", 3, false);
+  if (utils::Parallel::getProcessRank() == 0) {
+    mesh::Vertex &v0 = mesh.createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+    mesh::Vertex &v1 = mesh.createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+    mesh::Vertex &v2 = mesh.createVertex(Eigen::Vector3d(0.0, 1.0, 0.0));
+    mesh::Vertex &v3 = mesh.createVertex(Eigen::Vector3d(1.0, 1.0, 0.0));
+    mesh::Vertex &v4 = mesh.createVertex(Eigen::Vector3d(2.0, 1.0, 0.0));
+    for (int i = 0; i < 5; i++) {
+      mesh.vertices()[i].setGlobalIndex(10 + i);
+    }
+    mesh::Edge &e0 = mesh.createEdge(v0, v1);
+    mesh::Edge &e1 = mesh.createEdge(v1, v2);
+    mesh::Edge &e2 = mesh.createEdge(v2, v0);
+    mesh::Edge &e3 = mesh.createEdge(v1, v3);
+    mesh::Edge &e4 = mesh.createEdge(v3, v2);
+    mesh.createEdge(v3, v4);
+    mesh.createTriangle(e0, e1, e2);
+    mesh.createTriangle(e1, e3, e4);
+  }
+
+  std::vector<int> involvedRanks = {0, 1};
+  MPI_Comm         comm          = utils::Parallel::getRestrictedCommunicator(involvedRanks);
+  if (utils::Parallel::getProcessRank() < 2) {
+    utils::Parallel::setGlobalCommunicator(comm);
+    com::PtrCommunication com(new com::MPIDirectCommunication());
+    // Sends the coordinates in three messages, the receiver follows the sender
+    CommunicateMesh comMesh(com, utils::Parallel::getProcessRank() == 0 ? 2 : 0);
+
+    if (utils::Parallel::getProcessRank() == 0) {
+      utils::Parallel::splitCommunicator(participant0);
+      com->acceptConnection(participant0, participant1);
+      comMesh.sendMesh(mesh, 0);
+    } else if (utils::Parallel::getProcessRank() == 1) {
+      mesh.createVertex(Eigen::Vector3d::Constant(9.0));
+      utils::Parallel::splitCommunicator(participant1);
+      com->requestConnection(participant0, participant1, 0, 1);
+      comMesh.receiveMesh(mesh, 0);
+      BOOST_TEST(mesh.vertices().size() == 6);
+      BOOST_TEST(mesh.edges().size() == 6);
+      BOOST_TEST(mesh.triangles().size() == 2);
+      BOOST_TEST(testing::equals(mesh.vertices()[4].getCoords(), Eigen::Vector3d(1.0, 1.0, 0.0)));
+      BOOST_TEST(testing::equals(mesh.vertices()[5].getCoords(), Eigen::Vector3d(2.0, 1.0, 0.0)));
+      for (int i = 0; i < 5; i++) {
+        BOOST_TEST(mesh.vertices()[i + 1].getGlobalIndex() == 10 + i);
+      }
+      BOOST_TEST(&mesh.edges()[5].vertex(0) == &mesh.vertices()[4]);
+      BOOST_TEST(&mesh.edges()[5].vertex(1) == &mesh.vertices()[5]);
+      BOOST_TEST(&mesh.triangles()[1].edge(0) == &mesh.edges()[1]);
+      BOOST_TEST(&mesh.triangles()[1].edge(1) == &mesh.edges()[3]);
+      BOOST_TEST(&mesh.triangles()[1].edge(2) == &mesh.edges()[4]);
+    }
+    com->closeConnection();
+    utils::Parallel::clearGroups();
+    utils::Parallel::setGlobalCommunicator(utils::Parallel::getCommunicatorWorld());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Mesh
 
 BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -643,6 +643,10 @@ bool BaseCouplingScheme::measureConvergence(
     _convergenceWriter->writeData("Timestep", _timesteps);
     _convergenceWriter->writeData("Iteration", _iterations);
   }
+
+  // Gather the local norms of all measures to compute the global norms with one reduction
+  std::vector<Eigen::VectorXd> localSquaredNorms(_convergenceMeasures.size());
+  int                          normCount = 0;
   for (size_t i = 0; i < _convergenceMeasures.size(); i++) {
     ConvergenceMeasure &convMeasure = _convergenceMeasures[i];
 
@@ -657,7 +661,26 @@ bool BaseCouplingScheme::measureConvergence(
     if (designSpecifications.find(convMeasure.dataID) != designSpecifications.end())
       q = designSpecifications.at(convMeasure.dataID);
 
-    convMeasure.measure->measure(oldValues, *convMeasure.data->values, q);
+    localSquaredNorms[i] = convMeasure.measure->localSquaredNorms(oldValues, *convMeasure.data->values, q);
+    normCount += localSquaredNorms[i].size();
+  }
+  Eigen::VectorXd allLocalSquaredNorms(normCount);
+  int             offset = 0;
+  for (const Eigen::VectorXd &squaredNorms : localSquaredNorms) {
+    allLocalSquaredNorms.segment(offset, squaredNorms.size()) = squaredNorms;
+    offset += squaredNorms.size();
+  }
+  Eigen::VectorXd norms = utils::MasterSlave::allreduceNorms(allLocalSquaredNorms);
+
+  offset = 0;
+  for (size_t i = 0; i < _convergenceMeasures.size(); i++) {
+    ConvergenceMeasure &convMeasure = _convergenceMeasures[i];
+    if (convMeasure.level > 0)
+      continue;
+
+    int size = localSquaredNorms[i].size();
+    convMeasure.measure->measureNorms(norms.segment(offset, size));
+    offset += size;
 
     if (not utils::MasterSlave::_slaveMode) {
       std::stringstream sstm;
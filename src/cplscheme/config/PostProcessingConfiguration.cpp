@@ -233,7 +233,8 @@ void PostProcessingConfiguration::xmlTagCallback(
     _config.imvjChunkSize = callingTag.getIntAttributeValue(ATTR_IMVJCHUNKSIZE);
     auto f                = callingTag.getStringAttributeValue(ATTR_TYPE);
     if (f == VALUE_NO_RESTART) {
-      _config.imvjRestartType = impl::MVQNPostProcessing::NO_RESTART;
+      _config.imvjRSSVD_truncationEps = callingTag.getDoubleAttributeValue(ATTR_RSSVD_TRUNCATIONEPS);
+      _config.imvjRestartType         = impl::MVQNPostProcessing::NO_RESTART;
     } else if (f == VALUE_ZERO_RESTART) {
       _config.imvjRestartType = impl::MVQNPostProcessing::RS_ZERO;
     } else if (f == VALUE_LS_RESTART) {
@@ -500,7 +501,7 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
     attrRestartName.setDefaultValue(VALUE_SVD_RESTART);
     tagIMVJRESTART.addAttribute(attrRestartName);
     tagIMVJRESTART.setDocumentation("Type of IMVJ restart mode that is used\n"
-                                    "  no-restart: IMVJ runs in normal mode with explicit representation of Jacobian\n"
+                                    "  no-restart: IMVJ runs in normal mode with a truncated SVD of the Jacobian, which is updated after each time step\n"
                                     "  RS-ZERO:    IMVJ runs in restart mode. After M time steps all Jacobain information is dropped, restart with no information\n"
                                     "  RS-LS:      IMVJ runs in restart mode. After M time steps a IQN-LS like approximation for the initial guess of the Jacobian is computed.\n"
                                     "  RS-SVD:     IMVJ runs in restart mode. After M time steps a truncated SVD of the Jacobian is updated.\n"
@@ -512,7 +513,8 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
     attrReusedTimeStepsAtRestart.setDocumentation("If IMVJ restart-mode=RS-LS, the number of reused time steps at restart can be specified.");
     attrReusedTimeStepsAtRestart.setDefaultValue(8);
     XMLAttribute<double> attrRSSVD_truncationEps(ATTR_RSSVD_TRUNCATIONEPS);
-    attrRSSVD_truncationEps.setDocumentation("If IMVJ restart-mode=RS-SVD, the truncation threshold for the updated SVD can be set.");
+    attrRSSVD_truncationEps.setDocumentation("If IMVJ restart-mode=RS-SVD or no-restart, the truncation threshold for the updated SVD can be set. "
+                                             "Without restart-mode tag, the SVD is not truncated.");
     attrRSSVD_truncationEps.setDefaultValue(1e-4);
     tagIMVJRESTART.addAttribute(attrChunkSize);
     tagIMVJRESTART.addAttribute(attrReusedTimeStepsAtRestart);
@@ -44,12 +44,19 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
+  virtual Eigen::VectorXd localSquaredNorms(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
       const Eigen::VectorXd &designSpecification)
   {
-    _normDiff      = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+    Eigen::VectorXd squaredNorms(1);
+    squaredNorms << utils::MasterSlave::localSquaredNorm((newValues - oldValues) - designSpecification);
+    return squaredNorms;
+  }
+
+  virtual void measureNorms(const Eigen::VectorXd &norms)
+  {
+    _normDiff      = norms(0);
     _isConvergence = _normDiff <= _convergenceLimit;
     //      INFO("Absolute convergence measure: "
     //                     << "two-norm differences = " << normDiff
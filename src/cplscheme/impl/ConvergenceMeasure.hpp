@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include "utils/MasterSlave.hpp"
 
 namespace precice
 {
@@ -21,6 +22,11 @@ namespace impl
  * -# call newMeasurementSeries() for one set of iterations
  * -# call measure() for convergence measurement
  * -# retrieve the convergence status via isConvergence()
+ *
+ * A measurement is based on the l2-norms of some vectors computed from the
+ * data sets. To measure several data sets with one global reduction, call
+ * localSquaredNorms() for each of them, reduce all results together with
+ * utils::MasterSlave::allreduceNorms(), and hand them to measureNorms().
  */
 class ConvergenceMeasure
 {
@@ -37,11 +43,29 @@ public:
    * @param[in] oldValues Old iterate values.
    * @param[in] newValues New iterate values.
    */
-  virtual void measure(
+  void measure(
+      const Eigen::VectorXd &oldValues,
+      const Eigen::VectorXd &newValues,
+      const Eigen::VectorXd &designSpecification)
+  {
+    measureNorms(utils::MasterSlave::allreduceNorms(
+        localSquaredNorms(oldValues, newValues, designSpecification)));
+  }
+
+  /**
+   * @brief Returns the squared l2-norms of the local parts of the vectors the measurement is based on.
+   *
+   * @param[in] oldValues Old iterate values.
+   * @param[in] newValues New iterate values.
+   */
+  virtual Eigen::VectorXd localSquaredNorms(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
       const Eigen::VectorXd &designSpecification) = 0;
 
+  /// Performs convergence measurement with the global l2-norms of the vectors of localSquaredNorms().
+  virtual void measureNorms(const Eigen::VectorXd &norms) = 0;
+
   /// Returns true, if the last measurement indicates convergence.
   virtual bool isConvergence() const = 0;
 
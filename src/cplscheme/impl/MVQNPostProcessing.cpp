@@ -63,7 +63,8 @@ MVQNPostProcessing::MVQNPostProcessing(
       _usedColumnsPerTstep(5),
       _nbRestarts(0),
       //_info2(),
-      _avgRank(0)
+      _avgRank(0),
+      _svdPrecondConst(false)
 {
 }
 
@@ -73,7 +74,7 @@ MVQNPostProcessing::~MVQNPostProcessing()
   //if(utils::MasterSlave::_masterMode ||utils::MasterSlave::_slaveMode){ // not possible because of tests, MasterSlave is deactivated when PP is killed
 
   // close and shut down cyclic communication connections
-  if (not _imvjRestart) {
+  if (_alwaysBuildJacobian) {
     if (_cyclicCommRight != nullptr || _cyclicCommLeft != nullptr) {
       if ((utils::MasterSlave::_rank % 2) == 0) {
         _cyclicCommLeft->closeConnection();
@@ -100,8 +101,8 @@ void MVQNPostProcessing::initialize(
   if (_imvjRestartType > 0)
     _imvjRestart = true;
 
-  // only need cyclic communication if no MVJ restart mode is used
-  if (not _imvjRestart) {
+  // only need cyclic communication if the Jacobian is build explicitly
+  if (_alwaysBuildJacobian) {
     if (utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode) {
     /*
      * @todo: FIXME: This is a temporary and hacky realization of the cyclic commmunication between slaves
@@ -154,7 +155,7 @@ void MVQNPostProcessing::initialize(
 
   // initialize parallel matrix-matrix operation module
   _parMatrixOps = impl::PtrParMatrixOps(new impl::ParallelMatrixOperations());
-  _parMatrixOps->initialize(_cyclicCommLeft, _cyclicCommRight, not _imvjRestart);
+  _parMatrixOps->initialize(_cyclicCommLeft, _cyclicCommRight, _alwaysBuildJacobian);
   _svdJ.initialize(_parMatrixOps, getLSSystemRows());
 
   int entries  = _residuals.size();
@@ -166,8 +167,8 @@ void MVQNPostProcessing::initialize(
     global_n = _dimOffsets.back();
   }
 
-  if (not _imvjRestart) {
-    // only need memory for Jacobain of not in restart mode
+  if (_alwaysBuildJacobian) {
+    // only need memory for Jacobain if it is build explicitly
     _invJacobian    = Eigen::MatrixXd::Zero(global_n, entries);
     _oldInvJacobian = Eigen::MatrixXd::Zero(global_n, entries);
   }
@@ -216,8 +217,7 @@ void MVQNPostProcessing::updateDifferenceMatrices(
   BaseQNPostProcessing::updateDifferenceMatrices(cplData);
 
   // update _Wtil if the efficient computation of the quasi-Newton update is used
-  // or update current Wtil if the restart mode of imvj is used
-  if (not _alwaysBuildJacobian || _imvjRestart) {
+  if (not _alwaysBuildJacobian) {
     if (_firstIteration && (_firstTimeStep || _forceInitialRelaxation)) {
       // do nothing: constant relaxation
     } else {
@@ -237,32 +237,24 @@ void MVQNPostProcessing::updateDifferenceMatrices(
         // add column: Wtil(:,0) = W(:,0) - sum_q [ Wtil^q * ( Z^q * V(:,0)) ]
         //                                         |--- J_prev ---|
         // iterate over all stored Wtil and Z matrices in current chunk
-        if (_imvjRestart) {
-          for (int i = 0; i < (int) _WtilChunk.size(); i++) {
-            int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
-            assertion(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
-            Eigen::VectorXd Zv = Eigen::VectorXd::Zero(colsLSSystemBackThen);
-            // multiply: Zv := Z^q * V(:,0) of size (m x 1)
-            _parMatrixOps->multiply(_pseudoInverseChunk[i], v, Zv, colsLSSystemBackThen, getLSSystemRows(), 1);
-            // multiply: Wtil^q * Zv  dimensions: (n x m) * (m x 1), fully local
-            wtil += _WtilChunk[i] * Zv;
-          }
+        // multiply: Zv := Z^q * V(:,0) of size (m x 1) for all chunks at once
+        Eigen::MatrixXd Zv     = multiplyPseudoInverses(v);
+        int             offset = 0;
+        for (int i = 0; i < (int) _WtilChunk.size(); i++) {
+          int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
+          assertion(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
+          // multiply: Wtil^q * Zv  dimensions: (n x m) * (m x 1), fully local
+          wtil += _WtilChunk[i] * Zv.col(0).segment(offset, colsLSSystemBackThen);
+          offset += colsLSSystemBackThen;
+        }
 
-          // store columns if restart mode = RS-LS
-          if (_imvjRestartType == RS_LS) {
-            if (_matrixCols_RSLS.front() < _usedColumnsPerTstep) {
-              utils::appendFront(_matrixV_RSLS, v);
-              utils::appendFront(_matrixW_RSLS, w);
-              _matrixCols_RSLS.front()++;
-            }
+        // store columns if restart mode = RS-LS
+        if (_imvjRestartType == RS_LS) {
+          if (_matrixCols_RSLS.front() < _usedColumnsPerTstep) {
+            utils::appendFront(_matrixV_RSLS, v);
+            utils::appendFront(_matrixW_RSLS, w);
+            _matrixCols_RSLS.front()++;
           }
-
-          // imvj without restart is used, but efficient update, i.e. no Jacobian assembly in each iteration
-          // add column: Wtil(:,0) = W(:,0) - J_prev * V(:,0)
-        } else {
-          // compute J_prev * V(0) := wtil the new column in _Wtil of dimension: (n x n) * (n x 1) = (n x 1),
-          //                                        parallel: (n_global x n_local) * (n_local x 1) = (n_local x 1)
-          _parMatrixOps->multiply(_oldInvJacobian, v, wtil, _dimOffsets, getLSSystemRows(), getLSSystemRows(), 1, false);
         }
         wtil *= -1;
         wtil += w;
@@ -356,21 +348,22 @@ void MVQNPostProcessing::buildWtil()
 
   _Wtil = Eigen::MatrixXd::Zero(_qrV.rows(), _qrV.cols());
 
-  // imvj restart mode: re-compute Wtil: Wtil = W - sum_q [ Wtil^q * (Z^q*V) ]
-  //                                                      |--- J_prev ---|
+  // factorized Jacobian: re-compute Wtil: Wtil = W - sum_q [ Wtil^q * (Z^q*V) ]
+  //                                                         |--- J_prev ---|
   // iterate over all stored Wtil and Z matrices in current chunk
-  if (_imvjRestart) {
+  if (not _alwaysBuildJacobian) {
+    // multiply: ZV := Z^q * V of size (m x m) with m=#cols for all chunks at once, stored on each proc.
+    Eigen::MatrixXd ZV     = multiplyPseudoInverses(_matrixV);
+    int             offset = 0;
     for (int i = 0; i < (int) _WtilChunk.size(); i++) {
       int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
       assertion(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
-      Eigen::MatrixXd ZV = Eigen::MatrixXd::Zero(colsLSSystemBackThen, _qrV.cols());
-      // multiply: ZV := Z^q * V of size (m x m) with m=#cols, stored on each proc.
-      _parMatrixOps->multiply(_pseudoInverseChunk[i], _matrixV, ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
       // multiply: Wtil^q * ZV  dimensions: (n x m) * (m x m), fully local and embarrassingly parallel
-      _Wtil += _WtilChunk[i] * ZV;
+      _Wtil += _WtilChunk[i] * ZV.middleRows(offset, colsLSSystemBackThen);
+      offset += colsLSSystemBackThen;
     }
 
-    // imvj without restart is used, i.e., recompute Wtil: Wtil = W - J_prev * V
+    // Jacobian is build explicitly, i.e., recompute Wtil: Wtil = W - J_prev * V
   } else {
     // multiply J_prev * V = W_til of dimension: (n x n) * (n x m) = (n x m),
     //                                    parallel:  (n_global x n_local) * (n_local x m) = (n_local x m)
@@ -386,42 +379,36 @@ void MVQNPostProcessing::buildWtil()
 }
 
 // ==================================================================================
-void MVQNPostProcessing::buildJacobian()
+Eigen::MatrixXd MVQNPostProcessing::multiplyPseudoInverses(
+    const Eigen::MatrixXd &M,
+    const Eigen::MatrixXd *Z)
 {
   TRACE();
-  /**      --- compute inverse Jacobian ---
-  *
-  * J_inv = J_inv_n + (W - J_inv_n*V)*(V^T*V)^-1*V^T
-  *
-  * assumes that J_prev, V, W are already preconditioned
-  */
-
-  /**
-   *  (1) computation of pseudo inverse Z = (V^TV)^-1 * V^T
-   */
-  Eigen::MatrixXd Z(_qrV.cols(), _qrV.rows());
-  pseudoInverse(Z);
-
-  /**
-  *  (2) Multiply J_prev * V =: W_tilde
-  */
-  assertion(_matrixV.rows() == _qrV.rows(), _matrixV.rows(), _qrV.rows());
-  assertion(getLSSystemCols() == _qrV.cols(), getLSSystemCols(), _qrV.cols());
-  if (_resetLS) {
-    buildWtil();
-    WARN(" ATTENTION, in buildJacobian call for buildWtill() - this should not be the case except the coupling did only one iteration");
+  int rows = (Z != nullptr) ? Z->rows() : 0;
+  for (const Eigen::MatrixXd &Zq : _pseudoInverseChunk) {
+    rows += Zq.rows();
   }
 
-  /** (3) compute invJacobian = W_til*Z
-  *
-  *  where Z = (V^T*V)^-1*V^T via QR-dec and back-substitution       dimension: (n x n) * (n x m) = (n x m),
-  *  and W_til = (W - J_inv_n*V)                                     parallel:  (n_global x n_local) * (n_local x m) = (n_local x m)
-  */
-  _parMatrixOps->multiply(_Wtil, Z, _invJacobian, _dimOffsets, getLSSystemRows(), getLSSystemCols(), getLSSystemRows());
-  // --------
+  // local part of all products, i.e., (m_q x n_local) * (n_local x cols)
+  Eigen::MatrixXd localProducts(rows, M.cols());
+  int             offset = 0;
+  for (const Eigen::MatrixXd &Zq : _pseudoInverseChunk) {
+    assertion(Zq.cols() == M.rows(), Zq.cols(), M.rows());
+    localProducts.middleRows(offset, Zq.rows()).noalias() = Zq * M;
+    offset += Zq.rows();
+  }
+  if (Z != nullptr) {
+    assertion(Z->cols() == M.rows(), Z->cols(), M.rows());
+    localProducts.bottomRows(Z->rows()).noalias() = *Z * M;
+  }
 
-  // update Jacobian
-  _invJacobian = _invJacobian + _oldInvJacobian;
+  // if serial computation on single processor, i.e, no master-slave mode
+  if ((not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode) || localProducts.size() == 0) {
+    return localProducts;
+  }
+  Eigen::MatrixXd products(rows, M.cols());
+  utils::MasterSlave::allreduceSum(localProducts.data(), products.data(), localProducts.size());
+  return products;
 }
 
 // ==================================================================================
@@ -432,13 +419,14 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
   TRACE();
   
   /**      --- update inverse Jacobian efficient, ---
+  *   Do not recompute W_til in every iteration and never build the Jacobian.
+  *
   *   If normal mode is used:
-  *   Do not recompute W_til in every iteration and do not build
-  *   the entire Jacobian matrix. This is only necessary if the coupling
-  *   iteration has converged, namely in the last iteration.
+  *   The Jacobian of the previous time step is stored as truncated SVD, i.e., Wtil^0 = Psi,
+  *   Z^0 = Sigma * Phi^T, which is updated with Wtil and Z after each time step.
   *
   *   If restart-mode is used:
-  *   The Jacobian is never build. Store matrices Wtil^q and Z^q for the last M time steps.
+  *   Store matrices Wtil^q and Z^q for the last M time steps.
   *   After M time steps, a restart algorithm is performed basedon the restart-mode type, either
   *   Least-Squares restart (IQN-ILS like) or maintaining of a updated truncated SVD decomposition
   *   of the SVD.
@@ -478,7 +466,13 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
    */
   Eigen::VectorXd negativeResiduals = -_residuals;
   Eigen::VectorXd r_til             = Eigen::VectorXd::Zero(getLSSystemCols());
-  _parMatrixOps->multiply(Z, negativeResiduals, r_til, getLSSystemCols(), getLSSystemRows(), 1); // --------
+
+  /**
+   *  the products Z^q * (-res) of all chunks are reduced together with Z * (-res),
+   *  such that the whole update needs one global reduction.
+   */
+  Eigen::MatrixXd r_tilChunks = multiplyPseudoInverses(negativeResiduals, &Z);
+  r_til                       = r_tilChunks.col(0).tail(getLSSystemCols());
 
   /**
    * (4) compute _Wtil * r_til
@@ -495,24 +489,16 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
   /**
    *  (5) xUp = J_prev * (-res) + Wtil*Z*(-res)
    *
-   *  restart-mode: sum_q { Wtil^q * [ Z^q * (-res) ] },
-   *  where r_til = Z^q * (-res) is computed first and then xUp := Wtil^q * r_til
+   *  J_prev * (-res) = sum_q { Wtil^q * [ Z^q * (-res) ] },
+   *  where r_til = Z^q * (-res) is already computed above and xUp := Wtil^q * r_til
    */
-  if (_imvjRestart) {
-    for (int i = 0; i < (int) _WtilChunk.size(); i++) {
-      int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
-      assertion(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
-      r_til = Eigen::VectorXd::Zero(colsLSSystemBackThen);
-      // multiply: r_til := Z^q * (-res) of size (m x 1) with m=#cols of LS at that time, result stored on each proc.
-      _parMatrixOps->multiply(_pseudoInverseChunk[i], negativeResiduals, r_til, colsLSSystemBackThen, getLSSystemRows(), 1);
-      // multiply: Wtil^q * r_til  dimensions: (n x m) * (m x 1), fully local and embarrassingly parallel
-      xUpdate += _WtilChunk[i] * r_til;
-    }
-
-    // imvj without restart is used, i.e., compute directly J_prev * (-res)
-  } else {
-    _parMatrixOps->multiply(_oldInvJacobian, negativeResiduals, xUpdate, _dimOffsets, getLSSystemRows(), getLSSystemRows(), 1, false);
-    DEBUG("Mult J*V DONE");
+  int offset = 0;
+  for (int i = 0; i < (int) _WtilChunk.size(); i++) {
+    int colsLSSystemBackThen = _pseudoInverseChunk[i].rows();
+    assertion(colsLSSystemBackThen == _WtilChunk[i].cols(), colsLSSystemBackThen, _WtilChunk[i].cols());
+    // multiply: Wtil^q * r_til  dimensions: (n x m) * (m x 1), fully local and embarrassingly parallel
+    xUpdate += _WtilChunk[i] * r_tilChunks.col(0).segment(offset, colsLSSystemBackThen);
+    offset += colsLSSystemBackThen;
   }
 
   xUpdate += xUptmp;
@@ -572,59 +558,14 @@ void MVQNPostProcessing::restartIMVJ()
   //               ------------ RESTART SVD ------------
   if (_imvjRestartType == MVQNPostProcessing::RS_SVD) {
 
-    // we need to compute the updated SVD of the scaled Jacobian matrix
-    // |= APPLY PRECONDITIONING  J_prev = Wtil^q, Z^q  ===|
-    for (int i = 0; i < (int) _WtilChunk.size(); i++) {
-      _preconditioner->apply(_WtilChunk[i]);
-      _preconditioner->revert(_pseudoInverseChunk[i], true);
-    }
-    // |===================                            ===|
-
     int rankBefore = _svdJ.isSVDinitialized() ? _svdJ.rank() : 0;
 
-    // if it is the first time step, there is no initial SVD, so take all Wtil, Z matrices
-    // otherwise, the first element of each container holds the decomposition of the current
-    // truncated SVD, i.e., Wtil^0 = \phi, Z^0 = S\psi^T, this should not be added to the SVD.
-    int q = _svdJ.isSVDinitialized() ? 1 : 0;
-
-    // perform M-1 rank-1 updates of the truncated SVD-dec of the Jacobian
-    for (; q < (int) _WtilChunk.size(); q++) {
-      // update SVD, i.e., PSI * SIGMA * PHI^T <-- PSI * SIGMA * PHI^T + Wtil^q * Z^q
-      _svdJ.update(_WtilChunk[q], _pseudoInverseChunk[q].transpose());
-      //  used_storage += 2*_WtilChunk.size();
-    }
-    // int m = _WtilChunk[q].cols(), n = _WtilChunk[q].rows();
-    //used_storage += 2*rankBefore*m + 4*m*n + 2*m*m + (rankBefore+m)*(rankBefore+m) + 2*n*(rankBefore+m);
-
-    // drop all stored Wtil^q, Z^q matrices
-    _WtilChunk.clear();
-    _pseudoInverseChunk.clear();
-
-    auto &psi   = _svdJ.matrixPsi();
-    auto &sigma = _svdJ.singularValues();
-    auto &phi   = _svdJ.matrixPhi();
-
-    // multiply sigma * phi^T, phi is distributed block-row wise, phi^T is distributed block-column wise
-    // sigma is stored local on each proc, thus, the multiplication is fully local, no communication.
-    // Z = sigma * phi^T
-    Eigen::MatrixXd Z(phi.cols(), phi.rows());
-    for (int i = 0; i < (int) Z.rows(); i++)
-      for (int j = 0; j < (int) Z.cols(); j++)
-        Z(i, j) = phi(j, i) * sigma[i];
+    updateJacobianSVD();
 
     int rankAfter = _svdJ.rank();
     int waste     = _svdJ.getWaste();
     _avgRank += rankAfter;
 
-    // store factorized truncated SVD of J
-    _WtilChunk.push_back(psi);
-    _pseudoInverseChunk.push_back(Z);
-
-    // |= REVERT PRECONDITIONING  J_prev = Wtil^0, Z^0  ==|
-    _preconditioner->revert(_WtilChunk.front());
-    _preconditioner->apply(_pseudoInverseChunk.front(), true);
-    // |===================                             ==|
-
     DEBUG("MVJ-RESTART, mode=SVD. Rank of truncated SVD of Jacobian " << rankAfter << ", new modes: " << rankAfter - rankBefore << ", truncated modes: " << waste << " avg rank: " << _avgRank / _nbRestarts);
     //double percentage = 100.0*used_storage/(double)theoreticalJ_storage;
     if (utils::MasterSlave::_masterMode || (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode))
@@ -746,6 +687,70 @@ void MVQNPostProcessing::restartIMVJ()
   }
 }
 
+// ==================================================================================
+void MVQNPostProcessing::updateJacobianSVD()
+{
+  TRACE();
+
+  // we need to compute the updated SVD of the scaled Jacobian matrix
+  // |= APPLY PRECONDITIONING  J_prev = Wtil^q, Z^q  ===|
+  for (int i = 0; i < (int) _WtilChunk.size(); i++) {
+    _preconditioner->apply(_WtilChunk[i]);
+    _preconditioner->revert(_pseudoInverseChunk[i], true);
+  }
+  // |===================                            ===|
+
+  // if the weights of the preconditioner changed since the last update, the SVD is scaled
+  // with outdated weights and is rebuild from its factors Wtil^0, Z^0 (scaled with the new weights)
+  if (not _svdPrecondConst) {
+    _svdJ.reset();
+  }
+
+  // if it is the first time step, there is no initial SVD, so take all Wtil, Z matrices
+  // otherwise, the first element of each container holds the decomposition of the current
+  // truncated SVD, i.e., Wtil^0 = \phi, Z^0 = S\psi^T, this should not be added to the SVD.
+  int q = _svdJ.isSVDinitialized() ? 1 : 0;
+
+  // perform M-1 rank-1 updates of the truncated SVD-dec of the Jacobian
+  for (; q < (int) _WtilChunk.size(); q++) {
+    // time steps with a single iteration do not add any information
+    if (_WtilChunk[q].cols() == 0)
+      continue;
+    // update SVD, i.e., PSI * SIGMA * PHI^T <-- PSI * SIGMA * PHI^T + Wtil^q * Z^q
+    _svdJ.update(_WtilChunk[q], _pseudoInverseChunk[q].transpose());
+  }
+  _svdPrecondConst = _preconditioner->isConst();
+
+  // drop all stored Wtil^q, Z^q matrices
+  _WtilChunk.clear();
+  _pseudoInverseChunk.clear();
+
+  // no information so far, i.e., J = 0
+  if (not _svdJ.isSVDinitialized())
+    return;
+
+  auto &psi   = _svdJ.matrixPsi();
+  auto &sigma = _svdJ.singularValues();
+  auto &phi   = _svdJ.matrixPhi();
+
+  // multiply sigma * phi^T, phi is distributed block-row wise, phi^T is distributed block-column wise
+  // sigma is stored local on each proc, thus, the multiplication is fully local, no communication.
+  // Z = sigma * phi^T
+  Eigen::MatrixXd Z(phi.cols(), phi.rows());
+  for (int i = 0; i < (int) Z.rows(); i++)
+    for (int j = 0; j < (int) Z.cols(); j++)
+      Z(i, j) = phi(j, i) * sigma[i];
+
+  // store factorized truncated SVD of J
+  _WtilChunk.push_back(psi);
+  _pseudoInverseChunk.push_back(Z);
+
+  // |= REVERT PRECONDITIONING  J_prev = Wtil^0, Z^0  ==|
+  _preconditioner->revert(_WtilChunk.front());
+  _preconditioner->apply(_pseudoInverseChunk.front(), true);
+  // |===================                             ==|
+}
+
 // ==================================================================================
 void MVQNPostProcessing::specializedIterationsConverged(
     DataMap &cplData)
@@ -780,7 +785,7 @@ void MVQNPostProcessing::specializedIterationsConverged(
   //_info2<<std::endl;
 
   // if efficient update of imvj is enabled
-  if (not _alwaysBuildJacobian || _imvjRestart) {
+  if (not _alwaysBuildJacobian) {
     // need to apply the preconditioner, as all data structures are reverted after
     // call to computeQNUpdate. Need to call this before the preconditioner is updated.
 
@@ -800,21 +805,20 @@ void MVQNPostProcessing::specializedIterationsConverged(
     _preconditioner->revert(_matrixV);
     // |===================          ============|
 
-    //              ------- RESTART/ JACOBIAN ASSEMBLY -------
-    if (_imvjRestart) {
-
-      // add the matrices Wtil and Z of the converged configuration to the storage containers
-      Eigen::MatrixXd Z(_qrV.cols(), _qrV.rows());
-      // compute pseudo inverse using QR factorization and back-substitution
-      // also compensates for the scaling of V, i.e.,
-      // reverts Z' = R^-1 * Q^T * P^-1 as Z := Z' * P
-      pseudoInverse(Z);
-
-      // push back unscaled pseudo Inverse, Wtil is also unscaled.
-      // all objects in Wtil chunk and Z chunk are NOT PRECONDITIONED
-      _WtilChunk.push_back(_Wtil);
-      _pseudoInverseChunk.push_back(Z);
+    //              ------- RESTART/ JACOBIAN UPDATE -------
+    // add the matrices Wtil and Z of the converged configuration to the storage containers
+    Eigen::MatrixXd Z(_qrV.cols(), _qrV.rows());
+    // compute pseudo inverse using QR factorization and back-substitution
+    // also compensates for the scaling of V, i.e.,
+    // reverts Z' = R^-1 * Q^T * P^-1 as Z := Z' * P
+    pseudoInverse(Z);
+
+    // push back unscaled pseudo Inverse, Wtil is also unscaled.
+    // all objects in Wtil chunk and Z chunk are NOT PRECONDITIONED
+    _WtilChunk.push_back(_Wtil);
+    _pseudoInverseChunk.push_back(Z);
 
+    if (_imvjRestart) {
       /**
        *  Restart the IMVJ according to restart type
        */
@@ -828,8 +832,9 @@ void MVQNPostProcessing::specializedIterationsConverged(
       // only in imvj normal mode with efficient update:
     } else {
 
-      // compute explicit representation of Jacobian
-      buildJacobian();
+      // fold Wtil * Z into the truncated SVD of the Jacobian
+      updateJacobianSVD();
+      DEBUG("Rank of truncated SVD of Jacobian " << _svdJ.rank() << ", truncated modes: " << _svdJ.getWaste());
     }
 
     /** in case of enforced initial relaxation, the matrices are cleared
@@ -842,8 +847,8 @@ void MVQNPostProcessing::specializedIterationsConverged(
     }
   }
 
-  // only store Jacobian if imvj is in normal mode, i.e., the Jacobian is build
-  if (not _imvjRestart) {
+  // only store Jacobian if it is build explicitly
+  if (_alwaysBuildJacobian) {
     // store inverse Jacobian from converged time step. NOT SCALED with preconditioner
     _oldInvJacobian = _invJacobian;
   }
@@ -855,11 +860,12 @@ void MVQNPostProcessing::removeMatrixColumn(
 {
   TRACE(columnIndex, _matrixV.cols());
   assertion(_matrixV.cols() > 1, _matrixV.cols());
-  assertion(_Wtil.cols() > 1);
 
-  // remove column from matrix _Wtil
-  if (not _resetLS && not _alwaysBuildJacobian)
+  // remove column from matrix _Wtil, it is only updated along with V if the Jacobian is not build
+  if (not _resetLS && not _alwaysBuildJacobian) {
+    assertion(_Wtil.cols() > 1);
     utils::removeColumnFromMatrix(_Wtil, columnIndex);
+  }
 
   BaseQNPostProcessing::removeMatrixColumn(columnIndex);
 }
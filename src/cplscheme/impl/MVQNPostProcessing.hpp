@@ -29,6 +29,12 @@ namespace impl
  * this data is relaxed using the same linear combination as computed for the
  * MVQN-related data. The data is called "secondary" henceforth and additional
  * old value and data matrices are needed for it.
+ *
+ * Unless the Jacobian is always built, the inverse Jacobian is never assembled.
+ * It is kept in factorized form J = sum_q Wtil^q * Z^q (or Psi * Sigma * Phi^T for RS-SVD
+ * and NO_RESTART), which needs O(n*m) memory. Applying it to a vector costs O(n*m) operations
+ * and one global reduction for all factors. Without restart, the Jacobian of the previous
+ * time step is a truncated SVD, which is updated with Wtil * Z after each time step.
  */
 class MVQNPostProcessing : public BaseQNPostProcessing
 {
@@ -76,19 +82,19 @@ public:
   virtual void specializedIterationsConverged(DataMap &cplData);
 
 private:
-  /// @brief: stores the approximation of the inverse Jacobian of the system at current time step.
+  /// @brief: stores the approximation of the inverse Jacobian of the system at current time step, only if _alwaysBuildJacobian = true.
   Eigen::MatrixXd _invJacobian;
 
-  /// @brief: stores the approximation of the inverse Jacobian from the previous time step.
+  /// @brief: stores the approximation of the inverse Jacobian from the previous time step, only if _alwaysBuildJacobian = true.
   Eigen::MatrixXd _oldInvJacobian;
 
   /// @brief: stores the sub result (W-J_prev*V) for the current iteration
   Eigen::MatrixXd _Wtil;
 
-  /// @brief: stores all Wtil matrices within the current chunk of the imvj restart mode, disabled if _imvjRestart = false.
+  /// @brief: stores all Wtil matrices within the current chunk, or the factor Psi of the SVD if _imvjRestart = false.
   std::vector<Eigen::MatrixXd> _WtilChunk;
 
-  /// @brief_ stores all pseudo inverses within the current chunk of the imvj restart mode, disabled if _imvjRestart = false.
+  /// @brief_ stores all pseudo inverses within the current chunk, or the factor Sigma * Phi^T of the SVD if _imvjRestart = false.
   std::vector<Eigen::MatrixXd> _pseudoInverseChunk;
 
   /// @brief: stores columns from previous  #_RSLSreusedTimesteps time steps if RS-LS restart-mode is active
@@ -113,22 +119,22 @@ private:
   SVDFactorization _svdJ;
 
   /** @brief: If true, the less efficient method to compute the quasi-Newton update is used,
-   *   that explicitly builds the Jacobian in each iteration. If set to false this is only done
-   *   in the very last iteration and the update is computed based on MATVEC products.
+   *   that explicitly builds the Jacobian in each iteration. If set to false the Jacobian is
+   *   never built and the update is computed based on MATVEC products with its factors.
    */
   bool _alwaysBuildJacobian;
 
   /** @brief: Indicates the type of the imvj restart-mode:
-    *  - NO_RESTART: imvj is run on normal mode which builds the Jacobian explicitly
+    *  - NO_RESTART: imvj is run on normal mode which keeps all information, up to the truncation of the SVD
     *  - RS-ZERO:    imvj is run in restart-mode. After M time steps all stored matrices are dropped
     *  - RS-LS:      imvj in restart-mode. After M time steps restart with LS approximation for initial Jacobian
     *  - RS-SVD:     imvj in restart mode. After M time steps, update of an truncated SVD of the Jacobian.
     */
   int _imvjRestartType;
 
-  /** @brief: If true, the imvj method is used with the restart chunk based approach that avoids
-    *  to explicitly build and store the Jacobian. If false, the Jacobian is stored and build, however,
-    *  no truncation of information is present.
+  /** @brief: If true, the imvj method is used with the restart chunk based approach that drops
+    *  information after M time steps. If false, the Jacobian of the previous time step is stored
+    *  as truncated SVD.
     */
   bool _imvjRestart;
 
@@ -148,6 +154,9 @@ private:
   //std::fstream _info2;
   double _avgRank;
 
+  /// @brief: true if the preconditioner was constant at the last update of _svdJ, i.e., _svdJ is scaled with the current weights.
+  bool _svdPrecondConst;
+
   /** @brief: comptes the MVQN update using QR decomposition of V,
     *        furthermore it updates the inverse of the system jacobian
     */
@@ -173,8 +182,7 @@ private:
     *  via the formula W_til.col(j) = W.col(j) - J_inv * V.col(j).
     *  Then, pure matrix-vector products are sufficient to compute the update within one iteration, i.e.,
     *  (1) x1 := J_prev*(-res) (2) y := Z(-res) (3) xUp := W_til*y + x1
-    *  The Jacobian matrix only needs to be set up in the very last iteration of one time step, i.e.
-    *  in iterationsConverged.
+    *  The Jacobian matrix is never set up, J_prev is applied as sum_q Wtil^q * (Z^q * v).
     */
   void computeNewtonUpdateEfficient(DataMap &cplData, Eigen::VectorXd &update);
 
@@ -182,9 +190,14 @@ private:
     */
   void pseudoInverse(Eigen::MatrixXd &pseudoInverse);
 
-  /** @brief: computes a explicit representation of the Jacobian, i.e., n x n matrix
+  /** @brief: computes the products Z^q * M of all stored chunks Z^q and, if given, Z * M
+    *  with one single global reduction. The products are stacked in the order of the chunks,
+    *  Z * M comes last. The result is small, i.e., (sum_q m_q x cols(M)), and stored on each proc.
+    *
+    *  This is the only communication needed to apply the factorized Jacobian
+    *  J_prev = sum_q Wtil^q * Z^q to a (distributed) matrix or vector M.
     */
-  void buildJacobian();
+  Eigen::MatrixXd multiplyPseudoInverses(const Eigen::MatrixXd &M, const Eigen::MatrixXd *Z = nullptr);
 
   /** @brief: re-computes the matrix _Wtil = ( W - J_prev * V) instead of updating it according to V
     */
@@ -198,6 +211,11 @@ private:
     */
   void restartIMVJ();
 
+  /** @brief: updates the truncated SVD of the Jacobian with all stored matrices Wtil^q, Z^q and
+    *  stores its factors Psi and Sigma * Phi^T as the only pair Wtil^0, Z^0.
+    */
+  void updateJacobianSVD();
+
   /// @brief: Removes one iteration from V,W matrices and adapts _matrixCols.
   virtual void removeMatrixColumn(int columnIndex);
 
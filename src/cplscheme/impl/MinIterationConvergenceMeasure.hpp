@@ -20,10 +20,16 @@ public:
 
   virtual void newMeasurementSeries();
 
-  virtual void measure(
+  /// No norms are needed to count iterations.
+  virtual Eigen::VectorXd localSquaredNorms(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
       const Eigen::VectorXd &designSpecification)
+  {
+    return Eigen::VectorXd();
+  }
+
+  virtual void measureNorms(const Eigen::VectorXd &norms)
   {
     TRACE();
     _currentIteration++;
@@ -8,6 +8,9 @@
 #include "utils/Globals.hpp"
 #include "utils/MasterSlave.hpp"
 #include <Eigen/Core>
+#include <algorithm>
+#include <array>
+#include <vector>
 
 namespace precice
 {
@@ -114,6 +117,9 @@ private:
   // @brief Logging device.
   static logging::Logger _log;
 
+  /// Double buffer for the blocks of the left matrix that are passed around in _multiplyNN.
+  std::array<std::vector<double>, 2> _cyclicBuffers;
+
   // @brief multiplies matrices based on a cyclic communication and block-wise matrix multiplication with a quadratic result matrix
   template <typename Derived1, typename Derived2>
   void _multiplyNN(
@@ -140,11 +146,17 @@ private:
     assertion(leftMatrix.rows() == rightMatrix.cols(), leftMatrix.rows(), rightMatrix.cols());
     assertion(result.rows() == p, result.rows(), p);
 
-    //int nextProc = (utils::MasterSlave::_rank + 1) % utils::MasterSlave::_size;
-    int prevProc = (utils::MasterSlave::_rank - 1 < 0) ? utils::MasterSlave::_size - 1 : utils::MasterSlave::_rank - 1;
-    int rows_rcv = (prevProc > 0) ? offsets[prevProc + 1] - offsets[prevProc] : offsets[1];
-    //Eigen::MatrixXd leftMatrix_rcv = Eigen::MatrixXd::Zero(rows_rcv, q);
-    Eigen::MatrixXd leftMatrix_rcv(rows_rcv, q);
+    // the blocks of leftMatrix travel around the ring in two alternating buffers, such that
+    // the next block is received while the current block is multiplied and handed over.
+    // The buffers are kept for subsequent calls.
+    int maxRows = 0;
+    for (int rank = 0; rank < utils::MasterSlave::_size; rank++) {
+      maxRows = std::max(maxRows, offsets[rank + 1] - offsets[rank]);
+    }
+    for (std::vector<double> &buffer : _cyclicBuffers) {
+      if ((int) buffer.size() < maxRows * q)
+        buffer.resize(maxRows * q);
+    }
 
     com::PtrRequest requestSend;
     com::PtrRequest requestRcv;
@@ -154,68 +166,63 @@ private:
       requestSend = _cyclicCommRight->aSend(leftMatrix.data(), leftMatrix.size(), 0);
 
     // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til      dim: rows_rcv x cols
-    if (leftMatrix_rcv.size() > 0)
-      requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
+    int sourceProc = (utils::MasterSlave::_rank - 1 < 0) ? utils::MasterSlave::_size - 1 : utils::MasterSlave::_rank - 1;
+    int rows_rcv   = offsets[sourceProc + 1] - offsets[sourceProc];
+    int current    = 0;
+    if (utils::MasterSlave::_size > 1 && rows_rcv * q > 0)
+      requestRcv = _cyclicCommLeft->aReceive(_cyclicBuffers[current].data(), rows_rcv * q, 0);
 
     // compute diagonal blocks where all data is local and no communication is needed
     // compute block matrices of J_inv of size (n_til x n_til), n_til = local n
-    Eigen::MatrixXd diagBlock(leftMatrix.rows(), leftMatrix.rows());
-    diagBlock.noalias() = leftMatrix * rightMatrix;
-
-    // set block at corresponding row-index on proc
     int off = offsets[utils::MasterSlave::_rank];
-    assertion(result.cols() == diagBlock.cols(), result.cols(), diagBlock.cols());
-    result.block(off, 0, diagBlock.rows(), diagBlock.cols()) = diagBlock;
+    assertion(result.cols() == rightMatrix.cols(), result.cols(), rightMatrix.cols());
+    result.block(off, 0, leftMatrix.rows(), rightMatrix.cols()).noalias() = leftMatrix * rightMatrix;
 
     /**
-		 * cyclic send-receive operation
-		 */
+     * cyclic send-receive operation
+     */
     for (int cycle = 1; cycle < utils::MasterSlave::_size; cycle++) {
 
       // wait until W_til from previous processor is fully received
-      if (requestSend != NULL)
-        requestSend->wait();
       if (requestRcv != NULL)
         requestRcv->wait();
+      // the other buffer is overwritten by the next receive, so it must not be in flight anymore
+      if (requestSend != NULL)
+        requestSend->wait();
+      requestRcv.reset();
+      requestSend.reset();
 
-      // leftMatrix (leftMatrix_rcv) is available - needed for local multiplication and hand over to next proc
-      Eigen::MatrixXd leftMatrix_copy(leftMatrix_rcv);
-
-      // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
-      if (cycle < utils::MasterSlave::_size - 1) {
-        if (leftMatrix_copy.size() > 0)
-          requestSend = _cyclicCommRight->aSend(leftMatrix_copy.data(), leftMatrix_copy.size(), 0);
-      }
-
-      // compute proc that owned leftMatrix_rcv (Wtil_rcv) at the very beginning for each cylce
+      // proc that owned leftMatrix_rcv (Wtil_rcv) at the very beginning for this and for the next cycle
+      sourceProc               = (utils::MasterSlave::_rank - cycle < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - cycle) : utils::MasterSlave::_rank - cycle;
       int sourceProc_nextCycle = (utils::MasterSlave::_rank - (cycle + 1) < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - (cycle + 1)) : utils::MasterSlave::_rank - (cycle + 1);
+      rows_rcv                 = offsets[sourceProc + 1] - offsets[sourceProc];
+      int rows_rcv_nextCycle   = offsets[sourceProc_nextCycle + 1] - offsets[sourceProc_nextCycle];
+      Eigen::Map<Eigen::MatrixXd> leftMatrix_rcv(_cyclicBuffers[current].data(), rows_rcv, q);
 
-      int sourceProc = (utils::MasterSlave::_rank - cycle < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - cycle) : utils::MasterSlave::_rank - cycle;
-
-      int rows_rcv_nextCycle = (sourceProc_nextCycle > 0) ? offsets[sourceProc_nextCycle + 1] - offsets[sourceProc_nextCycle] : offsets[1];
-      rows_rcv               = (sourceProc > 0) ? offsets[sourceProc + 1] - offsets[sourceProc] : offsets[1];
-      leftMatrix_rcv         = Eigen::MatrixXd::Zero(rows_rcv_nextCycle, q);
-
-      // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
       if (cycle < utils::MasterSlave::_size - 1) {
-        if (leftMatrix_rcv.size() > 0) // only receive data, if data has been sent
-          requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
-      }
+        // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
+        if (leftMatrix_rcv.size() > 0)
+          requestSend = _cyclicCommRight->aSend(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
 
-      if (requestSend != NULL)
-        requestSend->wait();
-      // compute block with new local data
-      Eigen::MatrixXd block(rows_rcv, rightMatrix.cols());
-      block.noalias() = leftMatrix_copy * rightMatrix;
+        // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
+        if (rows_rcv_nextCycle * q > 0) // only receive data, if data has been sent
+          requestRcv = _cyclicCommLeft->aReceive(_cyclicBuffers[1 - current].data(), rows_rcv_nextCycle * q, 0);
+      }
 
+      // compute block with new local data, while the communication of the next cycle is in flight
       // set block at corresponding index in J_inv
       // the row-offset of the current block is determined by the proc that sends the part of the W_til matrix
       // note: the direction and ordering of the cyclic sending operation is chosen s.t. the computed block is
       //       local on the current processor (in J_inv).
       off = offsets[sourceProc];
-      assertion(result.cols() == block.cols(), result.cols(), block.cols());
-      result.block(off, 0, block.rows(), block.cols()) = block;
+      result.block(off, 0, rows_rcv, rightMatrix.cols()).noalias() = leftMatrix_rcv * rightMatrix;
+
+      current = 1 - current;
     }
+
+    // wait for a send that might still be pending
+    if (requestSend != NULL)
+      requestSend->wait();
   }
 
   // @brief multiplies matrices based on a dot-product computation with a rectangular result matrix
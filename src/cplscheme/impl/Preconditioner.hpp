@@ -227,6 +227,18 @@ protected:
   /// True if _nbNonConstTimesteps >= _maxNonConstTimesteps, i.e., preconditioner is not updated any more.
   bool _freezed = false;
 
+  /// Returns the squared l2-norms of all sub-vectors of values, computed on distributed data with one reduction.
+  Eigen::VectorXd subVectorSquaredNorms(const Eigen::VectorXd &values) const
+  {
+    Eigen::VectorXd localSquaredNorms(_subVectorSizes.size());
+    size_t          offset = 0;
+    for (size_t k = 0; k < _subVectorSizes.size(); k++) {
+      localSquaredNorms(k) = utils::MasterSlave::localSquaredNorm(values.segment(offset, _subVectorSizes[k]));
+      offset += _subVectorSizes[k];
+    }
+    return utils::MasterSlave::allreduceSquaredNorms(localSquaredNorms);
+  }
+
   /**
    * @brief Update the scaling after every FSI iteration and require a new QR decomposition (if necessary)
    *
@@ -328,42 +328,28 @@ int QRFactorization::orthogonalize(
   bool            null        = false;
   bool            termination = false;
   double          rho0 = 0., rho1 = 0.;
-  Eigen::VectorXd u = Eigen::VectorXd::Zero(_rows);
-  Eigen::VectorXd s = Eigen::VectorXd::Zero(colNum);
-  r                 = Eigen::VectorXd::Zero(_cols);
+  Eigen::VectorXd s(colNum);
+  Eigen::VectorXd sNext(colNum);
+  r = Eigen::VectorXd::Zero(_cols);
 
-  rho   = utils::MasterSlave::l2norm(v); // distributed l2norm
+  // projections s = Q^T v and ||v|| in one global reduction
+  rho   = std::sqrt(projectAndNorm(v, colNum, s));
   rho0  = rho;
   int k = 0;
   while (!termination) {
 
-    // take a gram-schmidt iteration
-    u = Eigen::VectorXd::Zero(_rows);
-    for (int j = 0; j < colNum; j++) {
-
-      // dot-product <_Q(:,j), v >
-      Eigen::VectorXd Qc = _Q.col(j);
-
-      // dot product <_Q(:,j), v> =: r_ij
-      double r_ij = utils::MasterSlave::dot(Qc, v);
-      // save r_ij in s(j) = column of R
-      s(j) = r_ij;
-      // u is the sum of projections r_ij * _Q(:,j) =  _Q(:,j) * <_Q(:,j), v>
-      u += _Q.col(j) * r_ij;
-    }
+    // take a classical gram-schmidt iteration, subtract the projections s(j) * _Q(:,j) from v
+    if (colNum > 0)
+      v -= _Q.leftCols(colNum) * s;
     // add the furier coefficients over all orthogonalize iterations
-    for (int j = 0; j < colNum; j++) {
-      r(j) = r(j) + s(j);
-    }
-    // subtract projections from v, v is now orthogonal to columns of _Q
-    for (int i = 0; i < _rows; i++) {
-      v(i) = v(i) - u(i);
-    }
-    // rho1 = norm of orthogonalized new column v_tilde (though not normalized)
-    rho1 = utils::MasterSlave::l2norm(v); // distributed l2norm
+    r.head(colNum) += s;
 
-    // t = norm of r_(:,j) with j = colNum-1
-    double norm_coefficients = utils::MasterSlave::l2norm(s); // distributed l2norm
+    // rho1 = norm of orthogonalized new column v_tilde (though not normalized).
+    // The projections for a possible re-orthogonalization are reduced along with it.
+    rho1 = std::sqrt(projectAndNorm(v, colNum, sNext));
+
+    // t = norm of r_(:,j) with j = colNum-1, s is the same on all ranks
+    double norm_coefficients = s.norm();
     k++;
 
     // treat the special case m=n
@@ -403,6 +389,7 @@ int QRFactorization::orthogonalize(
         return -1;
       }
       rho0 = rho1;
+      s.swap(sNext);
 
       // termination, i.e., (rho0 + _omega * t < _theta *rho1)
     } else {
@@ -417,6 +404,38 @@ int QRFactorization::orthogonalize(
   return k;
 }
 
+double QRFactorization::projectAndNorm(
+    const Eigen::VectorXd &v,
+    int                    colNum,
+    Eigen::VectorXd &      s)
+{
+  TRACE(colNum);
+  if (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode) {
+    for (int j = 0; j < colNum; j++) {
+      s(j) = _Q.col(j).dot(v);
+    }
+    return v.squaredNorm();
+  }
+
+  // Local contributions, the squared norm of v is appended to the projections.
+  // They are summed up as in utils::MasterSlave::dot(), such that the result is
+  // the same as with one reduction per column.
+  Eigen::VectorXd local = Eigen::VectorXd::Zero(colNum + 1);
+  for (int j = 0; j < colNum; j++) {
+    for (int i = 0; i < _rows; i++) {
+      local(j) += _Q(i, j) * v(i);
+    }
+  }
+  for (int i = 0; i < _rows; i++) {
+    local(colNum) += v(i) * v(i);
+  }
+
+  Eigen::VectorXd global(colNum + 1);
+  utils::MasterSlave::allreduceSum(local.data(), global.data(), colNum + 1);
+  s = global.head(colNum);
+  return global(colNum);
+}
+
 /**
  * @short assuming Q(1:n,1:m) has nearly orthonormal columns, this procedure
  *   orthogonlizes v(1:n) to the columns of Q, and normalizes the result.
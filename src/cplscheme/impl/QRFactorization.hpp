@@ -17,7 +17,8 @@ namespace impl
 /**
  * @brief Class that provides functionality for a dynamic QR-decomposition, that can be updated 
  * in O(mn) flops if a column is inserted or deleted. 
- * The new colmn is orthogonalized to the existing columns in Q using a modified GramSchmidt algorithm.
+ * The new colmn is orthogonalized to the existing columns in Q using an iterated classical GramSchmidt
+ * algorithm (CGS2), which needs one global reduction per iteration in the master-slave case.
  * The zero-elements are generated using suitable givens-roatations.
  * The Interface provides fnctions such as insertColumn, deleteColumn at arbitrary position an push or pull 
  * column at front or back, resp. 
@@ -191,9 +192,18 @@ private:
   *
   *   Difference to the method orthogonalize_stable():
   *   if ||v_orth||/||v|| approx 0, no unit vector is inserted.
+  *   All projections Q^T v of an iteration are computed in a single global reduction,
+  *   while orthogonalize_stable() reduces every dot product separately.
    */
   int orthogonalize(Eigen::VectorXd &v, Eigen::VectorXd &r, double &rho, int colNum);
 
+  /**
+   * @brief Computes the projections s = Q(:,0:colNum-1)^T v and returns ||v||^2.
+   *
+   * In the master-slave case, both are summed up over all ranks in one allreduce.
+   */
+  double projectAndNorm(const Eigen::VectorXd &v, int colNum, Eigen::VectorXd &s);
+
   /**
   * @short computes parameters for givens matrix G for which  (x,y)G = (z,0). replaces (x,y) by (z,0)
   */
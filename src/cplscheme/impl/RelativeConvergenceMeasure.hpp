@@ -56,7 +56,7 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
+  virtual Eigen::VectorXd localSquaredNorms(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
       const Eigen::VectorXd &designSpecification)
@@ -68,9 +68,16 @@ public:
      std::cout<<"   design spec: \n"<<designSpecification<<"\n"<<std::endl;
      std::cout<<"-------\n"<<std::endl;
 */
+    Eigen::VectorXd squaredNorms(2);
+    squaredNorms << utils::MasterSlave::localSquaredNorm((newValues - oldValues) - designSpecification),
+                    utils::MasterSlave::localSquaredNorm(newValues + designSpecification);
+    return squaredNorms;
+  }
 
-    _normDiff      = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
-    _norm          = utils::MasterSlave::l2norm(newValues + designSpecification);
+  virtual void measureNorms(const Eigen::VectorXd &norms)
+  {
+    _normDiff      = norms(0);
+    _norm          = norms(1);
     _isConvergence = _normDiff <= _norm * _convergenceLimitPercent;
     //      INFO("Relative convergence measure: "
     //                    << "two-norm differences = " << normDiff
@@ -45,12 +45,19 @@ public:
     _normFirstResidual = std::numeric_limits<double>::max();
   }
 
-  virtual void measure(
+  virtual Eigen::VectorXd localSquaredNorms(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
       const Eigen::VectorXd &designSpecification)
   {
-    _normDiff = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+    Eigen::VectorXd squaredNorms(1);
+    squaredNorms << utils::MasterSlave::localSquaredNorm((newValues - oldValues) - designSpecification);
+    return squaredNorms;
+  }
+
+  virtual void measureNorms(const Eigen::VectorXd &norms)
+  {
+    _normDiff = norms(0);
     if (_isFirstIteration) {
       _normFirstResidual = _normDiff;
       _isFirstIteration  = false;
@@ -29,19 +29,11 @@ void ResidualSumPreconditioner::initialize(std::vector<size_t> &svs)
 void ResidualSumPreconditioner::_update_(bool timestepComplete, const Eigen::VectorXd &oldValues, const Eigen::VectorXd &res)
 {
   if (not timestepComplete) {
-    std::vector<double> norms(_subVectorSizes.size(), 0.0);
+    Eigen::VectorXd norms = subVectorSquaredNorms(res);
 
     double sum = 0.0;
-
-    int offset = 0;
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      Eigen::VectorXd part = Eigen::VectorXd::Zero(_subVectorSizes[k]);
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        part(i) = res(i + offset);
-      }
-      norms[k] = utils::MasterSlave::dot(part, part);
       sum += norms[k];
-      offset += _subVectorSizes[k];
       norms[k] = std::sqrt(norms[k]);
     }
     sum = std::sqrt(sum);
@@ -52,7 +44,7 @@ void ResidualSumPreconditioner::_update_(bool timestepComplete, const Eigen::Vec
       assertion(_residualSum[k] > 0);
     }
 
-    offset = 0;
+    int offset = 0;
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
       for (size_t i = 0; i < _subVectorSizes[k]; i++) {
         _weights[i + offset]    = 1 / _residualSum[k];
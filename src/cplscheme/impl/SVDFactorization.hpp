@@ -168,7 +168,7 @@ public:
 
     int waste = 0;
     for (int i = 0; i < (int) _sigma.size(); i++) {
-      if (_sigma(i) < (int) _sigma(0) * _truncationEps) {
+      if (_sigma(i) < _sigma(0) * _truncationEps) {
         _cols = i;
         waste = _sigma.size() - i;
         break;
@@ -23,20 +23,12 @@ void ValuePreconditioner::_update_(bool timestepComplete, const Eigen::VectorXd
 {
   if (timestepComplete || _firstTimestep) {
 
-    std::vector<double> norms(_subVectorSizes.size(), 0.0);
-
-    int offset = 0;
+    Eigen::VectorXd norms = subVectorSquaredNorms(oldValues).cwiseSqrt();
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      Eigen::VectorXd part = Eigen::VectorXd::Zero(_subVectorSizes[k]);
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        part(i) = oldValues(i + offset);
-      }
-      norms[k] = utils::MasterSlave::l2norm(part);
-      offset += _subVectorSizes[k];
       assertion(norms[k] > 0.0);
     }
 
-    offset = 0;
+    int offset = 0;
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
       for (size_t i = 0; i < _subVectorSizes[k]; i++) {
         _weights[i + offset]    = 1.0 / norms[k];
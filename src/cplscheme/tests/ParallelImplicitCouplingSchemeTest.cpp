@@ -8,6 +8,7 @@
 #include "cplscheme/impl/MVQNPostProcessing.hpp"
 #include "cplscheme/impl/BaseQNPostProcessing.hpp"
 #include "cplscheme/impl/ConstantPreconditioner.hpp"
+#include "cplscheme/impl/ResidualSumPreconditioner.hpp"
 #include "cplscheme/SharedPointer.hpp"
 #include "cplscheme/impl/SharedPointer.hpp"
 #include "cplscheme/Constants.hpp"
@@ -166,6 +167,89 @@ BOOST_AUTO_TEST_CASE(testMVQNPP)
   BOOST_TEST(testing::equals((*data.at(1)->values)(3), 8.28025852497733250157e-02));
 }
 
+BOOST_AUTO_TEST_CASE(testMVQNPPFactorizedJacobian)
+{
+  // Without restart, the Jacobian of the previous time steps is kept as SVD of its factors.
+  // Iterates over several time steps, such that the quasi-Newton updates depend on it.
+  int    maxIterationsUsed = 50;
+  int    timestepsReused = 0;
+  int    reusedTimestepsAtRestart = 0;
+  int    chunkSize = 0;
+  int filter = cplscheme::impl::PostProcessing::QR1FILTER;
+  int restartType = cplscheme::impl::MVQNPostProcessing::NO_RESTART;
+  double initialRelaxation = 0.1;
+  double singularityLimit = 1e-10;
+  double svdTruncationEps = 0.0;
+  bool enforceInitialRelaxation = false;
+  bool alwaysBuildJacobian = false;
+  std::vector<int> dataIDs;
+  dataIDs.push_back(0);
+  dataIDs.push_back(1);
+  mesh::PtrMesh dummyMesh ( new mesh::Mesh("dummyMesh", 3, false) );
+
+  // fixed-point operator H(x) = A*x + 0.1*sin(x) + t*b, which changes with the time step t
+  int n = 10;
+  Eigen::MatrixXd A(n, n);
+  Eigen::VectorXd b(n);
+  for (int i = 0; i < n; i++) {
+    b(i) = 1.0 + 0.1 * i;
+    for (int j = 0; j < n; j++) {
+      A(i, j) = 0.3 * std::sin(1.0 + i + 3.0 * j);
+    }
+  }
+
+  auto iterate = [&](cplscheme::impl::PtrPreconditioner prec) {
+    cplscheme::impl::MVQNPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
+        timestepsReused, filter, singularityLimit, dataIDs, prec, alwaysBuildJacobian,
+        restartType, chunkSize, reusedTimestepsAtRestart, svdTruncationEps);
+
+    Eigen::VectorXd dvalues = Eigen::VectorXd::Zero(n / 2);
+    Eigen::VectorXd fvalues = Eigen::VectorXd::Zero(n / 2);
+    PtrCouplingData dpcd(new CouplingData(&dvalues,dummyMesh,false,1));
+    PtrCouplingData fpcd(new CouplingData(&fvalues,dummyMesh,false,1));
+    DataMap data;
+    data.insert(std::pair<int,PtrCouplingData>(0,dpcd));
+    data.insert(std::pair<int,PtrCouplingData>(1,fpcd));
+    pp.initialize(data);
+
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(n);
+    for (int t = 1; t <= 3; t++) {
+      for (int it = 0; it < 4; it++) {
+        Eigen::VectorXd Hx = A * x + 0.1 * x.array().sin().matrix() + t * b;
+        dpcd->oldValues.col(0) = x.head(n / 2);
+        fpcd->oldValues.col(0) = x.tail(n / 2);
+        dvalues = Hx.head(n / 2);
+        fvalues = Hx.tail(n / 2);
+        if (it < 3) {
+          pp.performPostProcessing(data);
+          x << dvalues, fvalues;
+        } else {
+          pp.iterationsConverged(data);
+        }
+      }
+    }
+    return x;
+  };
+
+  // reference values of the former implementation with explicitly built Jacobian
+  std::vector<double> factors(2, 1.0);
+  cplscheme::impl::PtrPreconditioner constPrec(new cplscheme::impl::ConstantPreconditioner(factors));
+  Eigen::VectorXd x = iterate(constPrec);
+  Eigen::VectorXd expected(n);
+  expected << 3.6899877458823904242, 3.3196569571592764447, 2.9197107093713920989, 3.106641076968137849,
+              3.9653930174548106535, 5.0245608504576937392, 5.5649103968725581737, 5.2924858964144361195,
+              4.7643264052033593714, 4.742635647279131561;
+  BOOST_TEST(testing::equals(x, expected, 1e-12));
+
+  // the weights change in every iteration, hence the SVD is rebuilt in every time step
+  cplscheme::impl::PtrPreconditioner sumPrec(new cplscheme::impl::ResidualSumPreconditioner(-1));
+  x = iterate(sumPrec);
+  expected << 3.6899166424320384294, 3.3190469771360642248, 2.9189716958063374186, 3.1059905920184704975,
+              3.9649979616774513325, 5.0244817761026849823, 5.5644612700364115554, 5.2919013345382843738,
+              4.7634478486929365815, 4.7416715454475175662;
+  BOOST_TEST(testing::equals(x, expected, 1e-12));
+}
+
 BOOST_AUTO_TEST_CASE(testVIQNPP)
 {
   //use two vectors and see if underrelaxation works
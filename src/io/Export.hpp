@@ -45,6 +45,9 @@ public:
     const std::string& name,
     const std::string& location,
     mesh::Mesh&        mesh ) =0;
+
+  /// Waits until all previous exports are written, nothing to do for exporters writing directly.
+  virtual void flush() {}
 };
 
 }} // namespace precice, io
@@ -0,0 +1,152 @@
+#include "ExportAsync.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Quad.hpp"
+
+namespace precice {
+namespace io {
+
+ExportAsync:: ExportAsync
+(
+  PtrExport exporter,
+  int       queueSize,
+  bool      dropWhenFull )
+:
+  Export(),
+  _exporter(std::move(exporter)),
+  _queueSize(queueSize),
+  _dropWhenFull(dropWhenFull)
+{
+  assertion(_exporter);
+  assertion(queueSize > 0, queueSize);
+  _writer = std::thread(&ExportAsync::writeJobs, this);
+}
+
+ExportAsync:: ~ExportAsync()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _changed.notify_all();
+  _writer.join();
+}
+
+int ExportAsync:: getType() const
+{
+  return _exporter->getType();
+}
+
+void ExportAsync:: doExport
+(
+  const std::string& name,
+  const std::string& location,
+  mesh::Mesh&        mesh)
+{
+  TRACE(name, location, mesh.getName());
+  std::unique_ptr<mesh::Mesh> snapshot;
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_queue.size() >= _queueSize) {
+      if (_dropWhenFull) {
+        WARN("Dropped export \"" << name << "\", since " << _queue.size()
+             << " previous exports are still waiting to be written.");
+        return;
+      }
+      DEBUG("Waiting for the writer thread, since the export queue is full.");
+      _changed.wait(lock, [this] { return _queue.size() < _queueSize; });
+    }
+    std::vector<std::unique_ptr<mesh::Mesh>>& spares = _spareSnapshots[mesh.getName()];
+    if (not spares.empty()) {
+      snapshot = std::move(spares.back());
+      spares.pop_back();
+    }
+  }
+
+  // The snapshot is not shared with the writer thread, which keeps on writing meanwhile
+  if (not snapshot) {
+    snapshot.reset(new mesh::Mesh(mesh.getName(), mesh.getDimensions(), mesh.isFlipNormals()));
+    for (const mesh::PtrData& data : mesh.data()) {
+      snapshot->createData(data->getName(), data->getDimensions());
+    }
+  }
+  copyMesh(mesh, *snapshot);
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _queue.push_back(Job{name, location, std::move(snapshot)});
+  }
+  _changed.notify_all();
+}
+
+void ExportAsync:: flush()
+{
+  TRACE();
+  std::unique_lock<std::mutex> lock(_mutex);
+  _changed.wait(lock, [this] { return _queue.empty() and not _writing; });
+}
+
+void ExportAsync:: writeJobs()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _changed.wait(lock, [this] { return _stop or not _queue.empty(); });
+    if (_queue.empty()) {
+      return; // Stopped and nothing left to write
+    }
+    Job job = std::move(_queue.front());
+    _queue.pop_front();
+    _writing = true;
+    lock.unlock();
+    _changed.notify_all(); // A queue slot is free again
+
+    _exporter->doExport(job.name, job.location, *job.snapshot);
+
+    lock.lock();
+    _writing = false;
+    _spareSnapshots[job.snapshot->getName()].push_back(std::move(job.snapshot));
+    _changed.notify_all();
+  }
+}
+
+void ExportAsync:: copyMesh
+(
+  mesh::Mesh& mesh,
+  mesh::Mesh& snapshot)
+{
+  snapshot.clear();
+  for (const mesh::Vertex& vertex : mesh.vertices()) {
+    mesh::Vertex& copy = snapshot.createVertex(vertex.getCoords());
+    copy.setNormal(vertex.getNormal());
+    copy.setGlobalIndex(vertex.getGlobalIndex());
+    copy.setOwner(vertex.isOwner());
+  }
+  // Elements are numbered consecutively, hence IDs in mesh equal positions in snapshot
+  mesh::Mesh::VertexContainer& vertices = snapshot.vertices();
+  for (const mesh::Edge& edge : mesh.edges()) {
+    assertion(edge.vertex(0).getID() < (int) vertices.size());
+    assertion(edge.vertex(1).getID() < (int) vertices.size());
+    snapshot.createEdge(vertices[edge.vertex(0).getID()], vertices[edge.vertex(1).getID()]);
+  }
+  mesh::Mesh::EdgeContainer& edges = snapshot.edges();
+  for (const mesh::Triangle& triangle : mesh.triangles()) {
+    snapshot.createTriangle(edges[triangle.edge(0).getID()], edges[triangle.edge(1).getID()],
+                            edges[triangle.edge(2).getID()]);
+  }
+  for (const mesh::Quad& quad : mesh.quads()) {
+    snapshot.createQuad(edges[quad.edge(0).getID()], edges[quad.edge(1).getID()],
+                        edges[quad.edge(2).getID()], edges[quad.edge(3).getID()]);
+  }
+
+  assertion(mesh.data().size() == snapshot.data().size());
+  for (size_t i = 0; i < mesh.data().size(); i++) {
+    assertion(mesh.data()[i]->getName() == snapshot.data()[i]->getName());
+    snapshot.data()[i]->values() = mesh.data()[i]->values();
+  }
+  snapshot.getVertexDistribution() = mesh.getVertexDistribution();
+}
+
+}} // namespace precice, io
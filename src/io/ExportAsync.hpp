@@ -0,0 +1,110 @@
+#pragma once
+
+#include "io/Export.hpp"
+#include "io/SharedPointer.hpp"
+#include "logging/Logger.hpp"
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace precice {
+  namespace mesh {
+    class Mesh;
+  }
+}
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief Runs another exporter in a background thread, such that the caller does not wait for the file system.
+ *
+ * doExport() copies the geometry, the data values and the vertex distribution of the mesh into a
+ * snapshot and appends it to a queue, which a writer thread works off in order. Snapshots are
+ * reused once written, hence at most queueSize+1 of them exist per mesh. If queueSize exports are
+ * already waiting, doExport() either blocks until the writer catches up or drops the export.
+ */
+class ExportAsync : public Export
+{
+public:
+
+  /**
+   * @brief Constructor, starts the writer thread.
+   *
+   * @param[in] exporter Exporter doing the actual export, only called from the writer thread.
+   * @param[in] queueSize Maximum number of exports waiting for the writer thread.
+   * @param[in] dropWhenFull If true, exports are dropped instead of waiting for a full queue.
+   */
+  ExportAsync (
+    PtrExport exporter,
+    int       queueSize,
+    bool      dropWhenFull );
+
+  /// Writes all queued exports and stops the writer thread.
+  virtual ~ExportAsync();
+
+  /// Returns the type of the wrapped exporter.
+  virtual int getType() const;
+
+  /// Enqueues a snapshot of the mesh for export.
+  virtual void doExport (
+    const std::string& name,
+    const std::string& location,
+    mesh::Mesh&        mesh );
+
+  /// Blocks until all queued exports are written.
+  virtual void flush();
+
+private:
+
+  /// Export waiting for the writer thread.
+  struct Job
+  {
+    std::string name;
+    std::string location;
+    std::unique_ptr<mesh::Mesh> snapshot;
+  };
+
+  logging::Logger _log{"io::ExportAsync"};
+
+  PtrExport _exporter;
+
+  size_t _queueSize;
+
+  bool _dropWhenFull;
+
+  /// Exports waiting for the writer thread, oldest first.
+  std::deque<Job> _queue;
+
+  /// Written snapshots available for reuse, per name of the exported mesh.
+  std::map<std::string, std::vector<std::unique_ptr<mesh::Mesh>>> _spareSnapshots;
+
+  /// True while the writer thread exports a job taken from the queue.
+  bool _writing = false;
+
+  /// Tells the writer thread to stop once the queue is empty.
+  bool _stop = false;
+
+  /// Protects all members above that are shared with the writer thread.
+  std::mutex _mutex;
+
+  /// Notified whenever a job is enqueued or finished, and on stopping.
+  std::condition_variable _changed;
+
+  std::thread _writer;
+
+  /// Main loop of the writer thread.
+  void writeJobs();
+
+  /// Copies vertices (with normals), edges, triangles, quads, data values and vertex distribution.
+  static void copyMesh (
+    mesh::Mesh& mesh,
+    mesh::Mesh& snapshot );
+};
+
+}} // namespace precice, io
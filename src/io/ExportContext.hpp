@@ -30,6 +30,18 @@ struct ExportContext
   // @brief If true, normals are plotted.
   bool plotNormals;
 
+  // @brief If true, parallel exports write binary instead of ASCII data.
+  bool writeBinary;
+
+  // @brief If true, exports are written by a background thread.
+  bool asynchronous;
+
+  // @brief Maximum number of asynchronous exports waiting to be written.
+  int queueSize;
+
+  // @brief If true, asynchronous exports are dropped instead of waiting for a full queue.
+  bool dropWhenFull;
+
   /**
    * @brief Constructor.
    */
@@ -40,7 +52,11 @@ struct ExportContext
     triggerSolverPlot(false),
     everyIteration(false),
     type(),
-    plotNormals(false)
+    plotNormals(false),
+    writeBinary(true),
+    asynchronous(false),
+    queueSize(2),
+    dropWhenFull(false)
   {}
 };
 
@@ -56,27 +56,27 @@ void ExportVTK::exportMesh
   TRACE(mesh.getName());
 
   // Plot vertices
-  outFile << "POINTS " << mesh.vertices().size() << " float "<<std::endl << std::endl;
+  outFile << "POINTS " << mesh.vertices().size() << " float \n\n";
   for (mesh::Vertex& vertex : mesh.vertices()) {
     writeVertex(vertex.getCoords(), outFile);
   }
-  outFile << std::endl;
+  outFile << '\n';
 
 
   // Plot edges
   if(mesh.getDimensions() == 2) {
     outFile << "CELLS " << mesh.edges().size() << " " << mesh.edges().size() * 3
-            << std::endl << std::endl;
+            << "\n\n";
     for (mesh::Edge & edge : mesh.edges()) {
       int internalIndices[2];
       internalIndices[0] = edge.vertex(0).getID();
       internalIndices[1] = edge.vertex(1).getID();
       writeLine(internalIndices, outFile);
     }
-    outFile << std::endl << "CELL_TYPES " << mesh.edges().size()
-            << std::endl << std::endl;
+    outFile << '\n' << "CELL_TYPES " << mesh.edges().size()
+            << "\n\n";
     for(size_t i = 0; i < mesh.edges().size(); ++i) {
-      outFile << "3" << std::endl;
+      outFile << "3" << '\n';
     }
   }
 
@@ -85,7 +85,7 @@ void ExportVTK::exportMesh
     size_t sizeTriangles = mesh.triangles().size();
     size_t sizeQuads = mesh.quads().size();
     outFile << "CELLS " << sizeTriangles + sizeQuads << " "
-            << sizeTriangles * 4 + sizeQuads * 5 << std::endl << std::endl;
+            << sizeTriangles * 4 + sizeQuads * 5 << "\n\n";
     for (mesh::Triangle& triangle : mesh.triangles()) {
       int internalIndices[3];
       internalIndices[0] = triangle.vertex(0).getID();
@@ -102,19 +102,19 @@ void ExportVTK::exportMesh
       writeQuadrangle(internalIndices, outFile);
     }
 
-    outFile << std::endl << "CELL_TYPES " << sizeTriangles + sizeQuads
-            << std::endl << std::endl;
+    outFile << '\n' << "CELL_TYPES " << sizeTriangles + sizeQuads
+            << "\n\n";
     for(size_t i=0; i < sizeTriangles; i++){
-      outFile << "5" << std::endl;
+      outFile << "5" << '\n';
     }
     for(size_t i=0; i < sizeQuads; i++){
-      outFile << "9" << std::endl;
+      outFile << "9" << '\n';
     }
 
 
     // OLD
 //    outFile << "CELLS " << mesh.triangles().size() << " "
-//            << mesh.triangles().size() * 4  << std::endl << std::endl;
+//            << mesh.triangles().size() * 4 << "\n\n";
 //    for (mesh::Triangle & triangle : mesh.triangles()){
 //      int internalIndices[3];
 //      internalIndices[0] = triangle.vertex(0).getID();
@@ -122,15 +122,15 @@ void ExportVTK::exportMesh
 //      internalIndices[2] = triangle.vertex(2).getID();
 //      writeTriangle(internalIndices, outFile);
 //    }
-//    outFile << std::endl << "CELL_TYPES " << mesh.triangles().size()
-//            << std::endl << std::endl;
+//    outFile << '\n' << "CELL_TYPES " << mesh.triangles().size()
+//            << "\n\n";
 //    for(size_t i=0; i < mesh.triangles().size(); i++){
-//      outFile << "5" << std::endl;
+//      outFile << "5" << '\n';
 //    }
 
   }
 
-  outFile << std::endl;
+  outFile << '\n';
 }
 
 void ExportVTK:: exportData
@@ -138,12 +138,12 @@ void ExportVTK:: exportData
   std::ofstream& outFile,
   mesh::Mesh&    mesh)
 {
-  outFile << "POINT_DATA " << mesh.vertices().size() << std::endl;
-  outFile << std::endl;
+  outFile << "POINT_DATA " << mesh.vertices().size() << '\n';
+  outFile << '\n';
 
   if(_writeNormals) { // Plot vertex normals
-    outFile << "VECTORS VertexNormals float" << std::endl;
-    outFile << std::endl;
+    outFile << "VECTORS VertexNormals float" << '\n';
+    outFile << '\n';
     for (mesh::Vertex& vertex : mesh.vertices()) {
       int i = 0;
       for(; i < mesh.getDimensions(); i++){
@@ -152,9 +152,9 @@ void ExportVTK:: exportData
       if(i < 3){
         outFile << "0";
       }
-      outFile << std::endl;
+      outFile << '\n';
     }
-    outFile << std::endl;
+    outFile << '\n';
 
     // Plot edge normals
 //    if(_plotNormals) {
@@ -177,7 +177,7 @@ void ExportVTK:: exportData
     Eigen::VectorXd& values = data->values();
     if(data->getDimensions() > 1) {
       Eigen::VectorXd viewTemp(data->getDimensions());
-      outFile << "VECTORS " << data->getName() << " float" << std::endl;
+      outFile << "VECTORS " << data->getName() << " float" << '\n';
       for (mesh::Vertex& vertex : mesh.vertices()) {
         int offset = vertex.getID() * data->getDimensions();
         for(int i=0; i < data->getDimensions(); i++){
@@ -190,17 +190,17 @@ void ExportVTK:: exportData
         if(i < 3){
           outFile << "0";
         }
-        outFile << std::endl;
+        outFile << '\n';
       }
-      outFile << std::endl;
+      outFile << '\n';
     }
     else if(data->getDimensions() == 1) {
-      outFile << "SCALARS " << data->getName() << " float" << std::endl;
-      outFile << "LOOKUP_TABLE default" << std::endl;
+      outFile << "SCALARS " << data->getName() << " float" << '\n';
+      outFile << "LOOKUP_TABLE default" << '\n';
       for (mesh::Vertex& vertex : mesh.vertices()) {
-        outFile << values(vertex.getID()) << std::endl;
+        outFile << values(vertex.getID()) << '\n';
       }
-      outFile << std::endl;
+      outFile << '\n';
     }
   }
 }
@@ -222,9 +222,9 @@ void ExportVTK:: writeHeader
 (
   std::ostream& outFile)
 {
-  outFile << "# vtk DataFile Version 2.0" << std::endl << std::endl
-          << "ASCII" << std::endl << std::endl
-          << "DATASET UNSTRUCTURED_GRID" << std::endl << std::endl;
+  outFile << "# vtk DataFile Version 2.0" << "\n\n"
+          << "ASCII" << "\n\n"
+          << "DATASET UNSTRUCTURED_GRID" << "\n\n";
 }
 
 void ExportVTK:: writeVertex
@@ -233,11 +233,11 @@ void ExportVTK:: writeVertex
   std::ostream&           outFile)
 {
   if(position.size() == 2) {
-    outFile << position(0) << "  " << position(1) << "  " << 0.0 << std::endl;
+    outFile << position(0) << "  " << position(1) << "  " << 0.0 << '\n';
   }
   else {
     assertion(position.size() == 3);
-    outFile << position(0) << "  " << position(1) << "  " << position(2) << std::endl;
+    outFile << position(0) << "  " << position(1) << "  " << position(2) << '\n';
   }
 }
 
@@ -251,7 +251,7 @@ void ExportVTK:: writeTriangle
   for(int i=0; i < 3; i++) {
     outFile << vertexIndices[i] << " ";
   }
-  outFile << std::endl;
+  outFile << '\n';
 }
 
 void ExportVTK:: writeQuadrangle
@@ -263,7 +263,7 @@ void ExportVTK:: writeQuadrangle
   for(int i=0; i < 4; i++) {
     outFile << vertexIndices[i] << " ";
   }
-  outFile << std::endl;
+  outFile << '\n';
 }
 
 void ExportVTK:: writeLine
@@ -275,7 +275,7 @@ void ExportVTK:: writeLine
   for(int i=0; i<2; i++) {
     outFile << vertexIndices[i] << " ";
   }
-  outFile << std::endl;
+  outFile << '\n';
 }
 
 }} // namespace precice, io
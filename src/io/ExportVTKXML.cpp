@@ -5,6 +5,8 @@
 #include "mesh/Triangle.hpp"
 #include "mesh/Quad.hpp"
 #include <Eigen/Core>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <fstream>
 #include <boost/filesystem.hpp>
@@ -15,10 +17,12 @@ namespace io {
 
 ExportVTKXML:: ExportVTKXML
 (
-  bool writeNormals )
+  bool writeNormals,
+  bool writeBinary )
 :
   Export(),
   _writeNormals(writeNormals),
+  _writeBinary(writeBinary),
   _meshDimensions(-1)
 {
 }
@@ -80,20 +84,20 @@ void ExportVTKXML::writeMasterFile
 
   CHECK(outMasterFile, "Could not open master file \"" << outfile.c_str() << "\" for VTKXML export!");
 
-  outMasterFile << "<?xml version=\"1.0\"?>" << std::endl;
+  outMasterFile << "<?xml version=\"1.0\"?>" << '\n';
   outMasterFile << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" byte_order=\"";
-  outMasterFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">")  << std::endl;
-  outMasterFile << "   <PUnstructuredGrid GhostLevel=\"0\">" << std::endl;
+  outMasterFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">")  << '\n';
+  outMasterFile << "   <PUnstructuredGrid GhostLevel=\"0\">" << '\n';
 
-  outMasterFile << "      <PPoints>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"Float32\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\"/>" << std::endl;
-  outMasterFile << "      </PPoints>" << std::endl;
+  outMasterFile << "      <PPoints>" << '\n';
+  outMasterFile << "         <PDataArray type=\"Float32\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\"/>" << '\n';
+  outMasterFile << "      </PPoints>" << '\n';
 
-  outMasterFile << "      <PCells>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\"/>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"offsets\"      NumberOfComponents=\"1\"/>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"UInt8\" Name=\"types\"        NumberOfComponents=\"1\"/>" << std::endl;
-  outMasterFile << "      </PCells>" << std::endl;
+  outMasterFile << "      <PCells>" << '\n';
+  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\"/>" << '\n';
+  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"offsets\"      NumberOfComponents=\"1\"/>" << '\n';
+  outMasterFile << "         <PDataArray type=\"UInt8\" Name=\"types\"        NumberOfComponents=\"1\"/>" << '\n';
+  outMasterFile << "      </PCells>" << '\n';
 
   // write scalar data names
   outMasterFile << "      <PPointData Scalars=\"";
@@ -105,25 +109,25 @@ void ExportVTKXML::writeMasterFile
   for (size_t i = 0; i < _vectorDataNames.size(); ++i) {
     outMasterFile << _vectorDataNames[i] << " ";
   }
-  outMasterFile << "\">" << std::endl;
+  outMasterFile << "\">" << '\n';
 
   for (size_t i = 0; i < _scalarDataNames.size(); ++i) {
-    outMasterFile << "         <PDataArray type=\"Float32\" Name=\""<< _scalarDataNames[i] << "\" NumberOfComponents=\"" << 1 << "\"/>" << std::endl;
+    outMasterFile << "         <PDataArray type=\"Float32\" Name=\""<< _scalarDataNames[i] << "\" NumberOfComponents=\"" << 1 << "\"/>" << '\n';
   }
 
   for (size_t i = 0; i < _vectorDataNames.size(); ++i) {
-    outMasterFile << "         <PDataArray type=\"Float32\" Name=\""<< _vectorDataNames[i] << "\" NumberOfComponents=\"" << 3 << "\"/>" << std::endl;
+    outMasterFile << "         <PDataArray type=\"Float32\" Name=\""<< _vectorDataNames[i] << "\" NumberOfComponents=\"" << 3 << "\"/>" << '\n';
   }
-  outMasterFile << "      </PPointData>" << std::endl;
+  outMasterFile << "      </PPointData>" << '\n';
 
   for (int i = 0; i < utils::MasterSlave::_size; i++) {
     if(mesh.getVertexDistribution()[i].size()>0){ //only non-empty subfiles
-      outMasterFile << "      <Piece Source=\"" << name << "_r" << i << ".vtu\"/>" << std::endl;
+      outMasterFile << "      <Piece Source=\"" << name << "_r" << i << ".vtu\"/>" << '\n';
     }
   }
 
-  outMasterFile << "   </PUnstructuredGrid>" << std::endl;
-  outMasterFile << "</VTKFile>" << std::endl;
+  outMasterFile << "   </PUnstructuredGrid>" << '\n';
+  outMasterFile << "</VTKFile>" << '\n';
 
   outMasterFile.close();
 }
@@ -145,23 +149,32 @@ void ExportVTKXML::writeSubFile
   namespace fs = boost::filesystem;
   fs::path outfile(location);
   outfile = outfile / fs::path(name + "_r" + std::to_string(utils::MasterSlave::_rank) + ".vtu");
-  std::ofstream outSubFile(outfile.string(), std::ios::trunc);
+  std::ofstream outSubFile(outfile.string(), std::ios::trunc | std::ios::binary);
 
   CHECK(outSubFile, "Could not open slave file \"" << outfile.c_str() << "\" for VTKXML export!");
 
-  outSubFile << "<?xml version=\"1.0\"?>" << std::endl;
+  _appendedData.clear();
+
+  outSubFile << "<?xml version=\"1.0\"?>\n";
   outSubFile << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-  outSubFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">")  << std::endl;
+  outSubFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">") << '\n';
 
-  outSubFile << "   <UnstructuredGrid>" << std::endl;
-  outSubFile << "      <Piece NumberOfPoints=\"" << numPoints << "\" NumberOfCells=\"" << numCells << "\"> " << std::endl;
-  outSubFile << "         <Points> " << std::endl;
-  outSubFile << "            <DataArray type=\"Float32\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\" format=\"ascii\"> " << std::endl;
+  outSubFile << "   <UnstructuredGrid>\n";
+  outSubFile << "      <Piece NumberOfPoints=\"" << numPoints << "\" NumberOfCells=\"" << numCells << "\"> \n";
+  outSubFile << "         <Points> \n";
+  std::vector<float> positions;
+  positions.reserve(3 * numPoints);
   for (mesh::Vertex& vertex : mesh.vertices()) {
-    writeVertex(vertex.getCoords(), outSubFile);
+    const mesh::Vertex::RawCoords& coords = vertex.getCoords();
+    for (int i = 0; i < coords.size(); i++) {
+      positions.push_back(coords(i));
+    }
+    if (coords.size() == 2) {
+      positions.push_back(0.0f); //also for 2D scenario, vtk needs 3D data
+    }
   }
-  outSubFile << "            </DataArray>" << std::endl;
-  outSubFile << "         </Points> " << std::endl << std::endl;
+  writeDataArray(outSubFile, "Float32", "Position", 3, positions);
+  outSubFile << "         </Points> \n\n";
 
   // Write Mesh
   exportMesh(outSubFile, mesh);
@@ -169,9 +182,15 @@ void ExportVTKXML::writeSubFile
   // Write data
   exportData(outSubFile, mesh);
 
-  outSubFile << "      </Piece>" << std::endl;
-  outSubFile << "   </UnstructuredGrid> " << std::endl;
-  outSubFile << "</VTKFile>" << std::endl;
+  outSubFile << "      </Piece>\n";
+  outSubFile << "   </UnstructuredGrid> \n";
+  if (_writeBinary) {
+    // All arrays follow the underscore in one block, the offsets of the DataArray elements refer to it
+    outSubFile << "   <AppendedData encoding=\"raw\">\n_";
+    outSubFile.write(_appendedData.data(), _appendedData.size());
+    outSubFile << "\n   </AppendedData>\n";
+  }
+  outSubFile << "</VTKFile>\n";
 
   outSubFile.close();
 }
@@ -181,65 +200,40 @@ void ExportVTKXML::exportMesh
   std::ofstream& outFile,
   mesh::Mesh&    mesh)
 {
+  std::vector<int>           connectivity;
+  std::vector<int>           offsets;
+  std::vector<unsigned char> types;
   if (_meshDimensions == 2) { // write edges as cells
-    outFile << "         <Cells>" << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
+    connectivity.reserve(2 * mesh.edges().size());
     for (mesh::Edge & edge : mesh.edges()) {
-      writeLine(edge, outFile);
+      connectivity.push_back(edge.vertex(0).getID());
+      connectivity.push_back(edge.vertex(1).getID());
+      offsets.push_back(connectivity.size());
     }
-    outFile << std::endl;
-    outFile << "            </DataArray> " << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.edges().size(); i++) {
-      outFile << 2*i << "  ";
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "            <DataArray type=\"UInt8\"  Name=\"types\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.edges().size(); i++) {
-      outFile << 3 << "  ";
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "         </Cells>" << std::endl;
+    types.assign(mesh.edges().size(), 3);
   } else { // write triangles and quads as cells
-
-    outFile << "         <Cells>" << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
+    connectivity.reserve(3 * mesh.triangles().size() + 4 * mesh.quads().size());
     for (mesh::Triangle& triangle : mesh.triangles()) {
-      writeTriangle(triangle, outFile);
+      for (int i = 0; i < 3; i++) {
+        connectivity.push_back(triangle.vertex(i).getID());
+      }
+      offsets.push_back(connectivity.size());
     }
     for (mesh::Quad& quad : mesh.quads()) {
-      writeQuadrangle(quad, outFile);
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray> " << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.triangles().size(); i++) {
-      outFile << 3*i << "  ";
-    }
-    for (size_t i = 1; i <= mesh.quads().size(); i++) {
-      outFile << 4*i << "  ";
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "            <DataArray type=\"UInt8\"  Name=\"types\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.triangles().size(); i++) {
-      outFile << 5 << "  ";
-    }
-    for (size_t i = 1; i <= mesh.quads().size(); i++) {
-      outFile << 9 << "  ";
+      for (int i = 0; i < 4; i++) {
+        connectivity.push_back(quad.vertex(i).getID());
+      }
+      offsets.push_back(connectivity.size());
     }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "         </Cells>" << std::endl;
+    types.assign(mesh.triangles().size(), 5);
+    types.insert(types.end(), mesh.quads().size(), 9);
   }
+
+  outFile << "         <Cells>\n";
+  writeDataArray(outFile, "Int32", "connectivity", 1, connectivity);
+  writeDataArray(outFile, "Int32", "offsets", 1, offsets);
+  writeDataArray(outFile, "UInt8", "types", 1, types);
+  outFile << "         </Cells>\n";
 }
 
 void ExportVTKXML:: exportData
@@ -255,88 +249,57 @@ void ExportVTKXML:: exportData
   for (size_t i = 0; i < _vectorDataNames.size(); i++) {
     outFile << _vectorDataNames[i] << " ";
   }
-  outFile << "\">" << std::endl;
+  outFile << "\">\n";
 
+  std::vector<float> valuesToWrite;
   for (mesh::PtrData data : mesh.data()) { // Plot vertex data
     Eigen::VectorXd& values = data->values();
     int dataDimensions = data->getDimensions();
-    std::string dataName(data->getName());
     int numberOfComponents = (dataDimensions==2) ? 3 : dataDimensions;
-    outFile << "            <DataArray type=\"Float32\" Name=\"" << dataName << "\" NumberOfComponents=\"" << numberOfComponents;
-    outFile << "\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    if(dataDimensions > 1) {
-      Eigen::VectorXd viewTemp(dataDimensions);
-      for (size_t count = 0; count < mesh.vertices().size(); count++) {
-        size_t offset = count * dataDimensions;
-        for(int i=0; i < dataDimensions; i++){
-          viewTemp[i] = values(offset + i);
-        }
-        for(int i = 0; i < dataDimensions; i++){
-          outFile << viewTemp[i] << " ";
-        }
-        if(dataDimensions == 2){
-          outFile << "0.0" << " "; //2D data needs to be 3D for vtk
-        }
-        outFile << " ";
+    valuesToWrite.clear();
+    valuesToWrite.reserve(numberOfComponents * mesh.vertices().size());
+    for (size_t count = 0; count < mesh.vertices().size(); count++) {
+      size_t offset = count * dataDimensions;
+      for (int i = 0; i < dataDimensions; i++) {
+        valuesToWrite.push_back(values(offset + i));
       }
-    }
-    else if(dataDimensions == 1) {
-      for (size_t count = 0; count < mesh.vertices().size(); count++) {
-        outFile << values(count) << " ";
+      if (dataDimensions == 2) {
+        valuesToWrite.push_back(0.0f); //2D data needs to be 3D for vtk
       }
     }
-    outFile << std::endl << "            </DataArray>" << std::endl;
+    writeDataArray(outFile, "Float32", data->getName(), numberOfComponents, valuesToWrite);
   }
-  outFile << "         </PointData> " << std::endl;
+  outFile << "         </PointData> \n";
 }
 
-void ExportVTKXML::writeVertex
+template<typename T>
+void ExportVTKXML:: writeDataArray
 (
-  const Eigen::VectorXd& position,
-  std::ofstream&         outFile)
+  std::ofstream&        outFile,
+  const std::string&    type,
+  const std::string&    name,
+  int                   numberOfComponents,
+  const std::vector<T>& values)
 {
-  outFile << "               ";
-  for (int i = 0; i < position.size(); i++){
-    outFile << position(i) << "  ";
-  }
-  if (position.size() ==2)
-  {
-    outFile << 0.0 << "  ";  //also for 2D scenario, vtk needs 3D data
+  outFile << "            <DataArray type=\"" << type << "\" Name=\"" << name
+          << "\" NumberOfComponents=\"" << numberOfComponents << "\" format=\"";
+  if (_writeBinary) {
+    outFile << "appended\" offset=\"" << _appendedData.size() << "\"/>\n";
+    // Every array is preceded by its size in bytes, as UInt32 in the default header type
+    assertion(values.size() * sizeof(T) <= std::numeric_limits<std::uint32_t>::max());
+    std::uint32_t numberOfBytes = values.size() * sizeof(T);
+    const char *header = reinterpret_cast<const char*>(&numberOfBytes);
+    const char *begin  = reinterpret_cast<const char*>(values.data());
+    _appendedData.insert(_appendedData.end(), header, header + sizeof(numberOfBytes));
+    _appendedData.insert(_appendedData.end(), begin, begin + numberOfBytes);
+  } else {
+    outFile << "ascii\">\n";
+    outFile << "               ";
+    for (const T& value : values) {
+      outFile << +value << "  "; // promotes UInt8 to be written as a number
+    }
+    outFile << "\n            </DataArray>\n";
   }
-  outFile << std::endl;
-}
-
-
-void ExportVTKXML:: writeTriangle
-(
-  mesh::Triangle& triangle,
-  std::ofstream&  outFile)
-{
-  outFile << triangle.vertex(0).getID() << "  ";
-  outFile << triangle.vertex(1).getID() << "  ";
-  outFile << triangle.vertex(2).getID() << "  ";
-
-}
-
-void ExportVTKXML:: writeQuadrangle
-(
-  mesh::Quad&    quad,
-  std::ofstream& outFile)
-{
-  outFile << quad.vertex(0).getID() << "  ";
-  outFile << quad.vertex(1).getID() << "  ";
-  outFile << quad.vertex(2).getID() << "  ";
-  outFile << quad.vertex(3).getID() << "  ";
-}
-
-void ExportVTKXML:: writeLine
-(
-  mesh::Edge& edge,
-  std::ofstream& outFile)
-{
-  outFile << edge.vertex(0).getID() << "  ";
-  outFile << edge.vertex(1).getID() << "  ";
 }
 
 }} // namespace precice, io
@@ -29,8 +29,10 @@ public:
    * @brief Standard constructor
    *
    * @param exportNormals  [IN] boolean: write normals to file?
+   * @param writeBinary    [IN] boolean: write the arrays of the sub files as appended raw binary data
+   *                            instead of ASCII text?
    */
-  ExportVTKXML ( bool writeNormals);
+  ExportVTKXML ( bool writeNormals, bool writeBinary = true );
 
   /// Returns the VTK type ID.
   virtual int getType() const;
@@ -41,22 +43,6 @@ public:
     const std::string& location,
     mesh::Mesh&        mesh );
 
-  static void writeVertex (
-    const Eigen::VectorXd& position,
-    std::ofstream&         outFile );
-
-  static void writeLine (
-    mesh::Edge&    edge,
-    std::ofstream& outFile );
-
-  static void writeTriangle (
-    mesh::Triangle& triangle,
-    std::ofstream&  outFile );
-
-  static void writeQuadrangle (
-    mesh::Quad&    quad,
-    std::ofstream& outFile );
-
 private:
 
    logging::Logger _log{"io::ExportVTKXML"};
@@ -64,6 +50,12 @@ private:
    /// By default set true: plot vertex normals, false: no normals plotting
    bool _writeNormals;
 
+   /// By default set true: write arrays as appended raw binary data, false: write ASCII text
+   bool _writeBinary;
+
+   /// Arrays of the current sub file in appended format, each preceded by its size in bytes
+   std::vector<char> _appendedData;
+
    /// dimensions of mesh
    int _meshDimensions;
 
@@ -106,6 +98,20 @@ private:
    void exportData (
      std::ofstream& outFile,
      mesh::Mesh&    mesh );
+
+   /**
+    * @brief Writes a DataArray element
+    *
+    * In binary mode, the values are added to the appended data in a single copy and the element
+    * only refers to them. Otherwise, the values are written inline as ASCII text.
+    */
+   template<typename T>
+   void writeDataArray (
+     std::ofstream&        outFile,
+     const std::string&    type,
+     const std::string&    name,
+     int                   numberOfComponents,
+     const std::vector<T>& values );
 };
 
 }} // namespace precice, io
@@ -24,6 +24,12 @@ ExportConfiguration:: ExportConfiguration
   ATTR_TRIGGER_SOLVER ( "trigger-solver" ),
   ATTR_NORMALS ( "normals" ),
   ATTR_EVERY_ITERATION("every-iteration"),
+  ATTR_BINARY("binary"),
+  ATTR_ASYNC("async"),
+  ATTR_QUEUE_SIZE("queue-size"),
+  ATTR_BACKPRESSURE("backpressure"),
+  VALUE_BLOCK("block"),
+  VALUE_DROP("drop"),
   _contexts()
 {
   using namespace xml;
@@ -61,12 +67,42 @@ ExportConfiguration:: ExportConfiguration
   attrEveryIteration.setDocumentation(doc);
   attrEveryIteration.setDefaultValue(false);
 
+  XMLAttribute<bool> attrBinary(ATTR_BINARY);
+  doc = "If set to on/yes, parallel participants write the arrays of their VTK XML files as ";
+  doc += "appended binary data. Set to off/no for ASCII files, e.g. for debug purposes.";
+  attrBinary.setDocumentation(doc);
+  attrBinary.setDefaultValue(true);
+
+  XMLAttribute<bool> attrAsync(ATTR_ASYNC);
+  doc = "If set to on/yes, exports are written by a background thread from a copy of the mesh, ";
+  doc += "such that the coupling does not wait for the file system.";
+  attrAsync.setDocumentation(doc);
+  attrAsync.setDefaultValue(false);
+
+  XMLAttribute<int> attrQueueSize(ATTR_QUEUE_SIZE);
+  doc = "Number of asynchronous exports that may wait for the background thread.";
+  attrQueueSize.setDocumentation(doc);
+  attrQueueSize.setDefaultValue(2);
+
+  XMLAttribute<std::string> attrBackpressure(ATTR_BACKPRESSURE);
+  doc = "Behavior of asynchronous exports, if the queue is full: \"" + VALUE_BLOCK + "\" waits for ";
+  doc += "the background thread, \"" + VALUE_DROP + "\" skips the export.";
+  attrBackpressure.setDocumentation(doc);
+  ValidatorEquals<std::string> validBlock(VALUE_BLOCK);
+  ValidatorEquals<std::string> validDrop(VALUE_DROP);
+  attrBackpressure.setValidator(validBlock || validDrop);
+  attrBackpressure.setDefaultValue(VALUE_BLOCK);
+
   for (XMLTag& tag : tags){
     tag.addAttribute(attrLocation);
     tag.addAttribute(attrTimestepInterval);
     tag.addAttribute(attrTriggerSolver);
     tag.addAttribute(attrNormals);
     tag.addAttribute(attrEveryIteration);
+    tag.addAttribute(attrBinary);
+    tag.addAttribute(attrAsync);
+    tag.addAttribute(attrQueueSize);
+    tag.addAttribute(attrBackpressure);
     parent.addSubtag(tag);
   }
 }
@@ -82,6 +118,11 @@ void ExportConfiguration:: xmlTagCallback
     context.timestepInterval = tag.getIntAttributeValue(ATTR_TIMESTEP_INTERVAL);
     context.plotNormals = tag.getBooleanAttributeValue(ATTR_NORMALS);
     context.everyIteration = tag.getBooleanAttributeValue(ATTR_EVERY_ITERATION);
+    context.writeBinary = tag.getBooleanAttributeValue(ATTR_BINARY);
+    context.asynchronous = tag.getBooleanAttributeValue(ATTR_ASYNC);
+    context.queueSize = tag.getIntAttributeValue(ATTR_QUEUE_SIZE);
+    CHECK(context.queueSize > 0, "Attribute \"" << ATTR_QUEUE_SIZE << "\" of export tag has to be positive!");
+    context.dropWhenFull = tag.getStringAttributeValue(ATTR_BACKPRESSURE) == VALUE_DROP;
     context.type = tag.getName();
     _contexts.push_back(context);
   }
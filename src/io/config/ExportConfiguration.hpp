@@ -81,6 +81,12 @@ private:
   const std::string ATTR_TRIGGER_SOLVER;
   const std::string ATTR_NORMALS;
   const std::string ATTR_EVERY_ITERATION;
+  const std::string ATTR_BINARY;
+  const std::string ATTR_ASYNC;
+  const std::string ATTR_QUEUE_SIZE;
+  const std::string ATTR_BACKPRESSURE;
+  const std::string VALUE_BLOCK;
+  const std::string VALUE_DROP;
 
   std::list<ExportContext> _contexts;
 };
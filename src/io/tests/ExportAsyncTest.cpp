@@ -0,0 +1,147 @@
+#include "io/ExportAsync.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Quad.hpp"
+#include "mesh/Vertex.hpp"
+#include "testing/Testing.hpp"
+#include <condition_variable>
+#include <mutex>
+
+BOOST_AUTO_TEST_SUITE(IOTests)
+
+BOOST_AUTO_TEST_SUITE(AsyncExport, * precice::testing::OnMaster())
+
+using namespace precice;
+
+namespace {
+
+/// Records what is exported, blocks in doExport() until released.
+class RecordingExport : public io::Export
+{
+public:
+  virtual int getType() const
+  {
+    return io::constants::exportVTK();
+  }
+
+  virtual void doExport(const std::string &name, const std::string &location, mesh::Mesh &mesh)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _started++;
+    _changed.notify_all();
+    _changed.wait(lock, [this] { return _released; });
+    names.push_back(name);
+    vertexCounts.push_back(mesh.vertices().size());
+    values.push_back(mesh.data()[0]->values()(0));
+    for (const mesh::Quad &quad : mesh.quads()) {
+      quadIDs.push_back(quad.getID());
+    }
+  }
+
+  void release()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _released = true;
+    _changed.notify_all();
+  }
+
+  void waitForStarted(int count)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _changed.wait(lock, [this, count] { return _started >= count; });
+  }
+
+  std::vector<std::string> names;
+  std::vector<size_t>      vertexCounts;
+  std::vector<double>      values;
+  std::vector<int>         quadIDs;
+
+private:
+  std::mutex              _mutex;
+  std::condition_variable _changed;
+  bool                    _released = false;
+  int                     _started  = 0;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(BlockWhenFull)
+{
+  mesh::Mesh mesh("MyMesh", 2, false);
+  mesh::PtrData data = mesh.createData("MyData", 1);
+  mesh.createVertex(Eigen::Vector2d(0.0, 0.0));
+  mesh.allocateDataValues();
+
+  auto recorder = std::make_shared<RecordingExport>();
+  recorder->release();
+  io::ExportAsync exporter(recorder, 1, false);
+  BOOST_TEST(exporter.getType() == io::constants::exportVTK());
+  for (int i = 0; i < 3; i++) {
+    mesh.createVertex(Eigen::Vector2d(1.0, i));
+    mesh.allocateDataValues();
+    data->values()(0) = i;
+    exporter.doExport("export" + std::to_string(i), "", mesh);
+  }
+  exporter.flush();
+
+  BOOST_TEST(recorder->names == std::vector<std::string>({"export0", "export1", "export2"}));
+  BOOST_TEST(recorder->vertexCounts == std::vector<size_t>({2, 3, 4}));
+  BOOST_TEST(recorder->values == std::vector<double>({0.0, 1.0, 2.0}));
+}
+
+BOOST_AUTO_TEST_CASE(DropWhenFull)
+{
+  mesh::Mesh mesh("MyMesh", 2, false);
+  mesh::PtrData data = mesh.createData("MyData", 1);
+  mesh.createVertex(Eigen::Vector2d(0.0, 0.0));
+  mesh.allocateDataValues();
+
+  auto recorder = std::make_shared<RecordingExport>();
+  io::ExportAsync exporter(recorder, 1, true);
+  data->values()(0) = 1.0;
+  exporter.doExport("first", "", mesh);
+  recorder->waitForStarted(1);
+  // The first export is being written, the second one waits in the queue, the third one is dropped
+  data->values()(0) = 2.0;
+  exporter.doExport("second", "", mesh);
+  data->values()(0) = 3.0;
+  exporter.doExport("third", "", mesh);
+  recorder->release();
+  exporter.flush();
+
+  BOOST_TEST(recorder->names == std::vector<std::string>({"first", "second"}));
+  BOOST_TEST(recorder->values == std::vector<double>({1.0, 2.0}));
+}
+
+BOOST_AUTO_TEST_CASE(ReuseQuadSnapshot)
+{
+  mesh::Mesh mesh("MyMesh", 3, false);
+  mesh::PtrData data = mesh.createData("MyData", 1);
+  mesh::Vertex &v0 = mesh.createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+  mesh::Vertex &v1 = mesh.createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+  mesh::Vertex &v2 = mesh.createVertex(Eigen::Vector3d(1.0, 1.0, 0.0));
+  mesh::Vertex &v3 = mesh.createVertex(Eigen::Vector3d(0.0, 1.0, 0.0));
+  mesh::Edge &e0 = mesh.createEdge(v0, v1);
+  mesh::Edge &e1 = mesh.createEdge(v1, v2);
+  mesh::Edge &e2 = mesh.createEdge(v2, v3);
+  mesh::Edge &e3 = mesh.createEdge(v3, v0);
+  mesh.createQuad(e0, e1, e2, e3);
+  mesh.allocateDataValues();
+
+  auto recorder = std::make_shared<RecordingExport>();
+  recorder->release();
+  io::ExportAsync exporter(recorder, 1, false);
+  // Each export reuses the snapshot of the previous one, which is cleared including its quads
+  for (int i = 0; i < 3; i++) {
+    data->values()(0) = i;
+    exporter.doExport("export" + std::to_string(i), "", mesh);
+    exporter.flush();
+  }
+
+  BOOST_TEST(recorder->vertexCounts == std::vector<size_t>({4, 4, 4}));
+  BOOST_TEST(recorder->quadIDs == std::vector<int>({0, 0, 0}));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // AsyncExport
+BOOST_AUTO_TEST_SUITE_END() // IOTests
@@ -29,6 +29,19 @@ BOOST_AUTO_TEST_CASE(Configuration)
     BOOST_TEST(context.timestepInterval == 1);
     BOOST_TEST(context.location == "somepath");
     BOOST_TEST(not context.triggerSolverPlot);
+    BOOST_TEST(context.writeBinary);
+    BOOST_TEST(not context.asynchronous);
+  }
+  {
+    tag.clear();
+    io::ExportConfiguration config(tag);
+    xml::configure(tag, testing::getPathToSources() + "/io/tests/config3.xml");
+    BOOST_TEST(config.exportContexts().size() == 1);
+    const io::ExportContext &context = config.exportContexts().front();
+    BOOST_TEST(not context.writeBinary);
+    BOOST_TEST(context.asynchronous);
+    BOOST_TEST(context.queueSize == 4);
+    BOOST_TEST(context.dropWhenFull);
   }
 }
 
@@ -10,6 +10,10 @@
 #include "utils/Globals.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/Parallel.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 
 // void ExportVTKXMLTest:: run()
 // {
@@ -178,6 +182,31 @@ BOOST_AUTO_TEST_CASE(ExportTriangulatedMesh)
   std::string      filename = "io-ExportVTKXMLTest-testExportTriangulatedMesh";
   std::string      location = "";
   exportVTKXML.doExport(filename, location, mesh);
+
+  bool             writeBinary = false;
+  io::ExportVTKXML exportVTKXMLASCII(exportNormals, writeBinary);
+  exportVTKXMLASCII.doExport(filename + "ASCII", location, mesh);
+
+  if (utils::Parallel::getProcessRank() == 2) {
+    // The positions are the first appended array, preceded by their size in bytes
+    std::ifstream subFile(filename + "_r2.vtu", std::ios::binary);
+    std::string   content((std::istreambuf_iterator<char>(subFile)), std::istreambuf_iterator<char>());
+    std::string   appendedTag = "<AppendedData encoding=\"raw\">\n_";
+    size_t        start       = content.find(appendedTag);
+    BOOST_TEST_REQUIRE(start != std::string::npos);
+    start += appendedTag.size();
+
+    std::uint32_t numberOfBytes = 0;
+    float         positions[9];
+    BOOST_TEST_REQUIRE(content.size() >= start + sizeof(numberOfBytes) + sizeof(positions));
+    std::memcpy(&numberOfBytes, &content[start], sizeof(numberOfBytes));
+    std::memcpy(positions, &content[start + sizeof(numberOfBytes)], sizeof(positions));
+    BOOST_TEST(numberOfBytes == sizeof(positions));
+    float expected[9] = {1.0, 1.0, 1.0, 2.0, 2.0, 2.0, 0.0, 1.0, 0.0};
+    for (int i = 0; i < 9; i++) {
+      BOOST_TEST(positions[i] == expected[i]);
+    }
+  }
 }
 
 BOOST_AUTO_TEST_CASE(ExportQuadMesh)
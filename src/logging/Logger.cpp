@@ -17,9 +17,6 @@ Logger::Logger(std::string module)
   log::add_common_attributes();
   log::core::get()->add_global_attribute("Scope", attrs::named_scope());
   log::core::get()->add_global_attribute("Rank", attrs::mutable_constant<int>(0));
-  log::core::get()->add_global_attribute("Line", attrs::mutable_constant<int>(0));
-  log::core::get()->add_global_attribute("File", attrs::mutable_constant<std::string>(""));
-  log::core::get()->add_global_attribute("Function", attrs::mutable_constant<std::string>(""));
 }
 
 }}
@@ -1,5 +1,5 @@
 #include "Tracer.hpp"
-#include <boost/log/attributes/mutable_constant.hpp>
+#include <boost/log/utility/manipulators/add_value.hpp>
 
 namespace precice {
 namespace logging {
@@ -22,13 +22,11 @@ Tracer::~Tracer()
 {
   using namespace boost::log;
 
-  attribute_cast<attributes::mutable_constant<int>>(core::get()->get_global_attributes()["Line"]).set(_line);
-
-  attribute_cast<attributes::mutable_constant<std::string>>(core::get()->get_global_attributes()["File"]).set(_file);
-
-  attribute_cast<attributes::mutable_constant<std::string>>(core::get()->get_global_attributes()["Function"]).set(_function);
-
-  BOOST_LOG_SEV(_log, trivial::severity_level::trace) << "Leaving " << _function;
+  BOOST_LOG_SEV(_log, trivial::severity_level::trace)
+    << add_value("Line", static_cast<int>(_line))
+    << add_value("File", _file)
+    << add_value("Function", _function)
+    << "Leaving " << _function;
 }
 
 }} // namespace precice,logging
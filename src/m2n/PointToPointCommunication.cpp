@@ -1,6 +1,7 @@
 #include "PointToPointCommunication.hpp"
 #include <vector>
 #include <thread>
+#include <unordered_map>
 #include "com/Communication.hpp"
 #include "com/CommunicationFactory.hpp"
 #include "mesh/Mesh.hpp"
@@ -218,8 +219,9 @@ void printLocalIndexCountStats(std::map<int, std::vector<int>> const &m)
 }
 
 // The approximate complexity of this function is O((number of local data
-// indices for the current rank in `thisVertexDistribution') * (total number of
-// data indices for all ranks in `otherVertexDistribution')).
+// indices for the current rank in `thisVertexDistribution') + (total number of
+// data indices for all ranks in `otherVertexDistribution')), since the ranks
+// of the other participant are looked up by global index in a hash map.
 std::map<int, std::vector<int>> buildCommunicationMap(
     // `localIndexCount' is the number of unique local indices for the current rank.
     size_t &localIndexCount,
@@ -241,16 +243,30 @@ std::map<int, std::vector<int>> buildCommunicationMap(
 
   auto const &indices = iterator->second;
 
+  // Only global indices used on this rank are of interest.
+  std::unordered_map<int, std::vector<int>> otherRanksOfIndex;
+  otherRanksOfIndex.reserve(indices.size());
+  for (int thisIndex : indices) {
+    otherRanksOfIndex.emplace(thisIndex, std::vector<int>());
+  }
+
+  // Ranks are visited in ascending order, so each rank is registered at most
+  // once per global index, even if it lists the index multiple times.
+  for (const auto &other : otherVertexDistribution) {
+    for (const auto &otherIndex : other.second) {
+      auto ranks = otherRanksOfIndex.find(otherIndex);
+      if (ranks != otherRanksOfIndex.end() &&
+          (ranks->second.empty() || ranks->second.back() != other.first)) {
+        ranks->second.push_back(other.first);
+      }
+    }
+  }
+
   int index = 0;
 
   for (int thisIndex : indices) {
-    for (const auto &other : otherVertexDistribution) {
-      for (const auto &otherIndex : other.second) {
-        if (thisIndex == otherIndex) {
-          communicationMap[other.first].push_back(index);
-          break;
-        }
-      }
+    for (int otherRank : otherRanksOfIndex[thisIndex]) {
+      communicationMap[otherRank].push_back(index);
     }
     ++index;
   }
@@ -440,8 +456,10 @@ void PointToPointCommunication::acceptConnection(std::string const &nameAcceptor
     // `communicationMap', and, therefore, for data structure consistency
     // of `_mappings' with the requester participant side, we simply
     // duplicate references to the same communication object `c'.
+    auto sendBuffer = std::make_shared<std::vector<double>>();
+    sendBuffer->reserve(indices.size() * _mesh->getDimensions());
     _mappings.push_back({
-        static_cast<int>(localRequesterRank), globalRequesterRank, std::move(indices), c, com::PtrRequest(), 0});
+        static_cast<int>(localRequesterRank), globalRequesterRank, std::move(indices), c, com::PtrRequest(), 0, sendBuffer});
   }
 
   _buffer.reserve(_totalIndexCount * _mesh->getDimensions());
@@ -571,8 +589,10 @@ void PointToPointCommunication::requestConnection(std::string const &nameAccepto
     // On the requester participant side, the communication objects behave
     // as clients, i.e. each of them requests only one connection to
     // acceptor process (in the acceptor participant).
+    auto sendBuffer = std::make_shared<std::vector<double>>();
+    sendBuffer->reserve(indices.size() * _mesh->getDimensions());
     _mappings.push_back({
-        0, globalAcceptorRank, std::move(indices), c, com::PtrRequest(), 0});
+        0, globalAcceptorRank, std::move(indices), c, com::PtrRequest(), 0, sendBuffer});
   }
 
   com::Request::wait(requests);
@@ -611,21 +631,29 @@ void PointToPointCommunication::send(double *itemsToSend,
   }
 
   assertion(size == _localIndexCount * valueDimension, size, _localIndexCount * valueDimension);
-  
+
+  // releases the send buffers of all completed requests
+  checkBufferedRequests(false);
+
   for (auto &mapping : _mappings) {
     mapping.offset = _buffer.size();
-    auto buffer = std::make_shared<std::vector<double>>();
-    buffer->reserve(mapping.indices.size() * valueDimension);
+    // The send buffer of a mapping is reused, unless the previous send from it is still pending.
+    // In that case, a new buffer is used such that sending never waits for the receiver.
+    if (mapping.sendBuffer.use_count() > 1) {
+      mapping.sendBuffer = std::make_shared<std::vector<double>>();
+    }
+    auto &buffer = *mapping.sendBuffer;
+    buffer.resize(mapping.indices.size() * valueDimension);
+    int i = 0;
     for (auto index : mapping.indices) {
       for (int d = 0; d < valueDimension; ++d) {
-        buffer->push_back(itemsToSend[index * valueDimension + d]);
+        buffer[i * valueDimension + d] = itemsToSend[index * valueDimension + d];
       }
+      i++;
     }
-    auto request = mapping.communication->aSend(*buffer, mapping.localRemoteRank);
-    bufferedRequests.emplace_back(request, buffer);
+    auto request = mapping.communication->aSend(buffer, mapping.localRemoteRank);
+    bufferedRequests.emplace_back(request, mapping.sendBuffer);
   }
-
-  checkBufferedRequests(false);
 }
 
 void PointToPointCommunication::receive(double *itemsToReceive,
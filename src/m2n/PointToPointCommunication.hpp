@@ -109,15 +109,17 @@ private:
    *           rank in the current participant) data to be communicated between
    *           the current process rank and the remote process rank;
    *        4. communication object (provides point-to-point communication
-   *           routines).
+   *           routines);
+   *        5. buffer the data to be sent is packed into.
    */
   struct Mapping {
-    int                   localRemoteRank;
-    int                   globalRemoteRank;
-    std::vector<int>      indices;
-    com::PtrCommunication communication;
-    com::PtrRequest       request;
-    size_t                offset;
+    int                                  localRemoteRank;
+    int                                  globalRemoteRank;
+    std::vector<int>                     indices;
+    com::PtrCommunication                communication;
+    com::PtrRequest                      request;
+    size_t                               offset;
+    std::shared_ptr<std::vector<double>> sendBuffer;
   };
 
   /**
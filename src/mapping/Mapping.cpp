@@ -48,6 +48,15 @@ Mapping::MeshRequirement Mapping:: getOutputRequirement() const
   return _outputRequirement;
 }
 
+void Mapping:: map
+(
+  const DataIDPairs& dataIDs )
+{
+  for (const auto& ids : dataIDs) {
+    map(ids.first, ids.second);
+  }
+}
+
 mesh::PtrMesh Mapping:: input() const
 {
   return _input;
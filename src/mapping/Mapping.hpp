@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>
+#include <vector>
 #include "mesh/Mesh.hpp"
 
 namespace precice {
@@ -43,6 +45,9 @@ public:
     FULL = 2
   };
 
+  /// Pairs of input and output data IDs, mapped together by map(const DataIDPairs&).
+  using DataIDPairs = std::vector<std::pair<int,int>>;
+
   /// Constructor, takes mapping constraint.
   Mapping ( Constraint constraint, int dimensions );
 
@@ -98,6 +103,15 @@ public:
     int inputDataID,
     int outputDataID ) =0;
 
+  /**
+   * @brief Maps several data fields from input mesh to output mesh at once.
+   *
+   * The default implementation calls map(int,int) for every pair. Mappings override
+   * this to traverse their coefficients or solve their interpolation system only
+   * once for all data fields.
+   */
+  virtual void map ( const DataIDPairs& dataIDs );
+
   /// Method used by partition. Tags vertices that could be owned by this rank.
   virtual void tagMeshFirstRound() = 0;
 
@@ -34,7 +34,7 @@ void NearestNeighborMapping:: computeMapping()
     _vertexIndices.resize(verticesSize);
     const mesh::Mesh::VertexContainer& outputVertices = output()->vertices();
     for ( size_t i=0; i < verticesSize; i++ ) {
-        const Eigen::VectorXd& coords = outputVertices[i].getCoords();
+        const auto& coords = outputVertices[i].getCoords();
         // Search for the output vertex inside the input mesh and add index to _vertexIndices
         rtree->query(boost::geometry::index::nearest(coords, 1),
                      boost::make_function_output_iterator([&](size_t const& val) {
@@ -50,7 +50,7 @@ void NearestNeighborMapping:: computeMapping()
     _vertexIndices.resize(verticesSize);
     const mesh::Mesh::VertexContainer& inputVertices = input()->vertices();
     for ( size_t i=0; i < verticesSize; i++ ){
-      const Eigen::VectorXd& coords = inputVertices[i].getCoords();
+      const auto& coords = inputVertices[i].getCoords();
       // Search for the input vertex inside the output mesh and add index to _vertexIndices
       rtree->query(boost::geometry::index::nearest(coords, 1),
                    boost::make_function_output_iterator([&](size_t const& val) {
@@ -80,23 +80,40 @@ void NearestNeighborMapping:: map
   int outputDataID )
 {
   TRACE(inputDataID, outputDataID);
-  const Eigen::VectorXd& inputValues = input()->data(inputDataID)->values();
-  Eigen::VectorXd& outputValues = output()->data(outputDataID)->values();
-  //assign(outputValues) = 0.0;
-  int valueDimensions = input()->data(inputDataID)->getDimensions();
-  assertion ( valueDimensions == output()->data(outputDataID)->getDimensions(),
-              valueDimensions, output()->data(outputDataID)->getDimensions() );
-  assertion ( inputValues.size() / valueDimensions == (int)input()->vertices().size(),
-               inputValues.size(), valueDimensions, input()->vertices().size() );
-  assertion ( outputValues.size() / valueDimensions == (int)output()->vertices().size(),
-               outputValues.size(), valueDimensions, output()->vertices().size() );
+  map(DataIDPairs{{inputDataID, outputDataID}});
+}
+
+void NearestNeighborMapping:: map
+(
+  const DataIDPairs& dataIDs )
+{
+  TRACE(dataIDs.size());
+  std::vector<const Eigen::VectorXd*> inputValues;
+  std::vector<Eigen::VectorXd*> outputValues;
+  std::vector<int> valueDimensions;
+  for (const auto& ids : dataIDs) {
+    int valueDim = input()->data(ids.first)->getDimensions();
+    inputValues.push_back(&input()->data(ids.first)->values());
+    outputValues.push_back(&output()->data(ids.second)->values());
+    valueDimensions.push_back(valueDim);
+    assertion ( valueDim == output()->data(ids.second)->getDimensions(),
+                valueDim, output()->data(ids.second)->getDimensions() );
+    assertion ( inputValues.back()->size() / valueDim == (int)input()->vertices().size(),
+                inputValues.back()->size(), valueDim, input()->vertices().size() );
+    assertion ( outputValues.back()->size() / valueDim == (int)output()->vertices().size(),
+                outputValues.back()->size(), valueDim, output()->vertices().size() );
+  }
+  size_t fields = dataIDs.size();
   if (getConstraint() == CONSISTENT){
     DEBUG("Map consistent");
     size_t outSize = output()->vertices().size();
     for ( size_t i=0; i < outSize; i++ ){
-      int inputIndex = _vertexIndices[i] * valueDimensions;
-      for ( int dim=0; dim < valueDimensions; dim++ ){
-        outputValues((i*valueDimensions)+dim) = inputValues(inputIndex+dim);
+      int inputVertex = _vertexIndices[i];
+      for ( size_t field=0; field < fields; field++ ){
+        int valueDim = valueDimensions[field];
+        for ( int dim=0; dim < valueDim; dim++ ){
+          (*outputValues[field])((i*valueDim)+dim) = (*inputValues[field])(inputVertex*valueDim+dim);
+        }
       }
     }
   }
@@ -105,9 +122,12 @@ void NearestNeighborMapping:: map
     DEBUG("Map conservative");
     size_t inSize = input()->vertices().size();
     for ( size_t i=0; i < inSize; i++ ){
-      int outputIndex = _vertexIndices[i] * valueDimensions;
-      for ( int dim=0; dim < valueDimensions; dim++ ){
-        outputValues(outputIndex+dim) += inputValues((i*valueDimensions)+dim);
+      int outputVertex = _vertexIndices[i];
+      for ( size_t field=0; field < fields; field++ ){
+        int valueDim = valueDimensions[field];
+        for ( int dim=0; dim < valueDim; dim++ ){
+          (*outputValues[field])(outputVertex*valueDim+dim) += (*inputValues[field])((i*valueDim)+dim);
+        }
       }
     }
   }
@@ -36,6 +36,9 @@ public:
     int inputDataID,
     int outputDataID ) override;
 
+  /// Maps several data fields with one traversal of the vertex indices.
+  virtual void map ( const DataIDPairs& dataIDs ) override;
+
   virtual void tagMeshFirstRound() override;
   virtual void tagMeshSecondRound() override;
 
@@ -1,10 +1,34 @@
 #include "NearestProjectionMapping.hpp"
 #include "query/FindClosest.hpp"
+#include "mesh/Group.hpp"
+#include "mesh/RTree.hpp"
 #include <Eigen/Core>
+#include <vector>
+#include <boost/function_output_iterator.hpp>
 
 namespace precice {
 namespace mapping {
 
+namespace {
+
+/// Number of edges, triangles and quads considered as candidates for a projection.
+const unsigned int primitiveCandidates = 4;
+
+/// Returns the primitives with the bounding boxes nearest to the given coordinates.
+template<typename COORDS_T>
+std::vector<mesh::rtree::PrimitiveBox> findNearestPrimitives
+(
+  const mesh::rtree::PrimitiveRTree& tree,
+  const COORDS_T&                    coords )
+{
+  std::vector<mesh::rtree::PrimitiveBox> result;
+  tree.query(boost::geometry::index::nearest(coords, primitiveCandidates),
+             std::back_inserter(result));
+  return result;
+}
+
+}
+
 NearestProjectionMapping:: NearestProjectionMapping
 (
   Constraint constraint,
@@ -28,35 +52,55 @@ NearestProjectionMapping:: NearestProjectionMapping
 void NearestProjectionMapping:: computeMapping()
 {
   TRACE(input()->vertices().size(), output()->vertices().size());
+  mesh::PtrMesh origins, search;
   if (getConstraint() == CONSISTENT){
     DEBUG("Compute consistent mapping");
-    _weights.resize(output()->vertices().size());
-    for ( size_t i=0; i < output()->vertices().size(); i++ ){
-      query::FindClosest findClosest(output()->vertices()[i].getCoords());
-      findClosest(*input()); // Search inside the input mesh for the output vertex
-      assertion(findClosest.hasFound());
-      const query::ClosestElement& closest = findClosest.getClosest();
-      _weights[i].clear();
-      for (const query::InterpolationElement& elem : closest.interpolationElements) {
-        _weights[i].push_back(elem);
-      }
-    }
+    origins = output();
+    search  = input();
   }
   else {
     assertion(getConstraint() == CONSERVATIVE, getConstraint());
     DEBUG("Compute conservative mapping");
-    _weights.resize(input()->vertices().size());
-    for ( size_t i=0; i < input()->vertices().size(); i++ ){
-      query::FindClosest findClosest(input()->vertices()[i].getCoords());
-      findClosest(*output());
-      assertion(findClosest.hasFound());
-      const query::ClosestElement& closest = findClosest.getClosest();
-      _weights[i].clear();
-      for (const query::InterpolationElement& elem : closest.interpolationElements) {
-        _weights[i].push_back(elem);
-      }
+    origins = input();
+    search  = output();
+  }
+
+  // Only the primitives whose bounding boxes are closest to the origin are
+  // candidates for the projection, the closest vertex serves as fallback.
+  namespace bgi = boost::geometry::index;
+  auto vertexTree   = mesh::rtree::getVertexRTree(search);
+  auto edgeTree     = mesh::rtree::getEdgeRTree(search);
+  auto triangleTree = mesh::rtree::getTriangleRTree(search);
+  auto quadTree     = mesh::rtree::getQuadRTree(search);
+
+  std::vector<Eigen::Triplet<double>> weights;
+  for ( size_t i=0; i < origins->vertices().size(); i++ ){
+    const auto& coords = origins->vertices()[i].getCoords();
+    mesh::Group candidates;
+    vertexTree->query(bgi::nearest(coords, 1),
+                      boost::make_function_output_iterator([&](size_t index) {
+                          candidates.add(search->vertices()[index]);
+                        }));
+    for (const auto& box : findNearestPrimitives(*edgeTree, coords)) {
+      candidates.add(search->edges()[box.second]);
+    }
+    for (const auto& box : findNearestPrimitives(*triangleTree, coords)) {
+      candidates.add(search->triangles()[box.second]);
+    }
+    for (const auto& box : findNearestPrimitives(*quadTree, coords)) {
+      candidates.add(search->quads()[box.second]);
+    }
+
+    query::FindClosest findClosest(coords);
+    findClosest(candidates); // Search inside the candidates for the origin vertex
+    assertion(findClosest.hasFound());
+    const query::ClosestElement& closest = findClosest.getClosest();
+    for (const query::InterpolationElement& elem : closest.interpolationElements) {
+      weights.emplace_back(i, elem.element->getID(), elem.weight);
     }
   }
+  _weights.resize(origins->vertices().size(), search->vertices().size());
+  _weights.setFromTriplets(weights.begin(), weights.end());
   _hasComputedMapping = true;
 }
 
@@ -68,7 +112,7 @@ bool NearestProjectionMapping:: hasComputedMapping() const
 void NearestProjectionMapping:: clear()
 {
   TRACE();
-  _weights.clear();
+  _weights = Eigen::SparseMatrix<double, Eigen::RowMajor>();
   _hasComputedMapping = false;
 }
 
@@ -78,47 +122,38 @@ void NearestProjectionMapping:: map
   int outputDataID )
 {
   TRACE(inputDataID, outputDataID);
-  mesh::PtrData inData = input()->data(inputDataID);
-  mesh::PtrData outData = output()->data(outputDataID);
-  const Eigen::VectorXd& inValues = inData->values();
-  Eigen::VectorXd& outValues = outData->values();
-  //assign(outValues) = 0.0;
-  int dimensions = inData->getDimensions();
-  assertion(dimensions == outData->getDimensions());
+  map(DataIDPairs{{inputDataID, outputDataID}});
+}
 
-  if (getConstraint() == CONSISTENT){
-    DEBUG("Map consistent");
-    assertion(_weights.size() == output()->vertices().size(),
-               _weights.size(), output()->vertices().size());
-    for (size_t i=0; i < output()->vertices().size(); i++){
-      InterpolationElements& elems = _weights[i];
-      size_t outOffset = i * dimensions;
-      for (query::InterpolationElement& elem : elems) {
-        size_t inOffset = (size_t)elem.element->getID() * dimensions;
-        for (int dim=0; dim < dimensions; dim++){
-          assertion(outOffset + dim < (size_t)outValues.size());
-          assertion(inOffset + dim < (size_t)inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
+void NearestProjectionMapping:: map
+(
+  const DataIDPairs& dataIDs )
+{
+  TRACE(dataIDs.size());
+  using ValuesMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  for (const auto& ids : dataIDs) {
+    mesh::PtrData inData = input()->data(ids.first);
+    mesh::PtrData outData = output()->data(ids.second);
+    int dimensions = inData->getDimensions();
+    assertion(dimensions == outData->getDimensions());
+    // Views of the values with one row per vertex
+    Eigen::Map<const ValuesMatrix> inValues(inData->values().data(),
+                                            inData->values().size() / dimensions, dimensions);
+    Eigen::Map<ValuesMatrix> outValues(outData->values().data(),
+                                       outData->values().size() / dimensions, dimensions);
+
+    if (getConstraint() == CONSISTENT){
+      DEBUG("Map consistent");
+      assertion(_weights.rows() == outValues.rows(), _weights.rows(), outValues.rows());
+      assertion(_weights.cols() == inValues.rows(), _weights.cols(), inValues.rows());
+      outValues.noalias() += _weights * inValues;
     }
-  }
-  else {
-    assertion(getConstraint() == CONSERVATIVE, getConstraint());
-    DEBUG("Map conservative");
-    assertion(_weights.size() == input()->vertices().size(),
-               _weights.size(), input()->vertices().size());
-    for (size_t i=0; i < input()->vertices().size(); i++){
-      size_t inOffset = i * dimensions;
-      InterpolationElements& elems = _weights[i];
-      for (query::InterpolationElement& elem : elems) {
-        size_t outOffset = (size_t)elem.element->getID() * dimensions;
-        for ( int dim=0; dim < dimensions; dim++ ){
-          assertion(outOffset + dim < (size_t)outValues.size());
-          assertion(inOffset + dim < (size_t)inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
+    else {
+      assertion(getConstraint() == CONSERVATIVE, getConstraint());
+      DEBUG("Map conservative");
+      assertion(_weights.rows() == inValues.rows(), _weights.rows(), inValues.rows());
+      assertion(_weights.cols() == outValues.rows(), _weights.cols(), outValues.rows());
+      outValues.noalias() += _weights.transpose() * inValues;
     }
   }
 }
@@ -129,28 +164,13 @@ void NearestProjectionMapping::tagMeshFirstRound()
 
   computeMapping();
 
-  if (getConstraint() == CONSISTENT){
-    for(mesh::Vertex& v : input()->vertices()){
-      for (size_t i=0; i < output()->vertices().size(); i++) {
-        const InterpolationElements& elems = _weights[i];
-        for (const query::InterpolationElement& elem : elems) {
-          if (elem.element->getID()==v.getID() && elem.weight!=0.0) {
-            v.tag();
-          }
-        }
-      }
-    }
-  }
-  else {
-    assertion(getConstraint() == CONSERVATIVE, getConstraint());
-    for(mesh::Vertex& v : output()->vertices()){
-      for (size_t i=0; i < input()->vertices().size(); i++) {
-        const InterpolationElements& elems = _weights[i];
-        for (const query::InterpolationElement& elem : elems) {
-          if (elem.element->getID()==v.getID() && elem.weight!=0.0) {
-            v.tag();
-          }
-        }
+  // The columns of the weights are the vertices of the input mesh
+  // (consistent) or the output mesh (conservative), which are to be tagged.
+  mesh::PtrMesh search = getConstraint() == CONSISTENT ? input() : output();
+  for (int i = 0; i < _weights.outerSize(); i++) {
+    for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(_weights, i); it; ++it) {
+      if (it.value() != 0.0) {
+        search->vertices()[it.col()].tag();
       }
     }
   }
@@ -1,10 +1,8 @@
 #pragma once
 
 #include "Mapping.hpp"
-#include <list>
-#include <vector>
+#include <Eigen/SparseCore>
 #include "logging/Logger.hpp"
-#include "query/FindClosest.hpp"
 
 namespace precice {
 namespace mapping {
@@ -44,6 +42,9 @@ public:
     int inputDataID,
     int outputDataID ) override;
 
+  /// Maps several data fields, each with one product of the sparse interpolation weights.
+  virtual void map ( const DataIDPairs& dataIDs ) override;
+
   virtual void tagMeshFirstRound() override;
   virtual void tagMeshSecondRound() override;
 
@@ -51,8 +52,13 @@ public:
 private:
   logging::Logger _log{"mapping::NearestProjectionMapping"};
 
-  typedef std::list<query::InterpolationElement> InterpolationElements;
-  std::vector<InterpolationElements> _weights;
+  /**
+   * @brief Interpolation weights, one row per origin vertex and one column per search vertex.
+   *
+   * Origins are the output vertices for a consistent mapping and the input vertices for a
+   * conservative one, which then maps with the transpose.
+   */
+  Eigen::SparseMatrix<double, Eigen::RowMajor> _weights;
 
   bool _hasComputedMapping;
 };
@@ -5,6 +5,7 @@
 
 #include <map>
 #include <numeric>
+#include <vector>
 
 #include "versions.hpp"
 #include "mesh/RTree.hpp"
@@ -89,6 +90,9 @@ public:
   /// Maps input data to output data from input mesh to output mesh.
   virtual void map(int inputDataID, int outputDataID) override;
 
+  /// Maps several data fields, one after another.
+  using Mapping::map;
+
   friend struct MappingTests::PetRadialBasisFunctionMapping::Serial::SolutionCaching;
 
   virtual void tagMeshFirstRound() override;
@@ -377,7 +381,9 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   // -- BEGIN FILL LOOP FOR MATRIX C --
   precice::utils::Event eFillC("PetRBF.fillC");
   // We collect entries for each row and set them blockwise using MatSetValues.
+  // The basis function is evaluated for all radii of a row at once.
   int preallocRow = 0;
+  std::vector<double> radii;
   for (const mesh::Vertex& inVertex : inMesh->vertices()) {
     if (not inVertex.isOwner())
       continue;
@@ -409,10 +415,11 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     }
 
     // -- SETS THE COEFFICIENTS --
+    radii.clear();
     if (_preallocation == Preallocation::SAVED or _preallocation == Preallocation::TREE) {
       const auto & rowVertices = vertexData[preallocRow];
       for (const auto & vertex : rowVertices) {
-        rowVals[colNum] = _basisFunction.evaluate(vertex.second);
+        radii.push_back(vertex.second);
         colIdx[colNum++] = vertex.first;
       }
       ++preallocRow;
@@ -429,12 +436,12 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
           }
         }
         if (_basisFunction.getSupportRadius() > distance.norm()) {
-          double coeff = _basisFunction.evaluate(distance.norm());
-          rowVals[colNum] = coeff;
+          radii.push_back(distance.norm());
           colIdx[colNum++] = col; // column of entry is the globalIndex
         }
       }
     }
+    _basisFunction.evaluate(radii.data(), rowVals, radii.size());
     ierr = MatSetValuesLocal(_matrixC, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
   }
   DEBUG("Finished filling Matrix C");
@@ -469,6 +476,7 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
 
   for (int row = ownerRangeABegin; row < ownerRangeAEnd; row++) {
     PetscInt colNum = 0;
+    radii.clear();
     PetscInt colIdx[_matrixA.getSize().second];     // holds the columns indices of the entries
     PetscScalar rowVals[_matrixA.getSize().second]; // holds the values of the entries
     const mesh::Vertex& oVertex = outMesh->vertices()[row - _matrixA.ownerRange().first];
@@ -494,7 +502,7 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     if (_preallocation == Preallocation::SAVED or _preallocation == Preallocation::TREE) {
       const auto & rowVertices = vertexData[row - ownerRangeABegin];
       for (const auto & vertex : rowVertices) {
-        rowVals[colNum] = _basisFunction.evaluate(vertex.second);
+        radii.push_back(vertex.second);
         colIdx[colNum++] = vertex.first;
       }
     }
@@ -506,12 +514,12 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
             distance[d] = 0;
         }
         if (_basisFunction.getSupportRadius() > distance.norm()) {
-          double coeff = _basisFunction.evaluate(distance.norm());
-          rowVals[colNum] = coeff;
+          radii.push_back(distance.norm());
           colIdx[colNum++] = inVertex.getGlobalIndex() + polyparams;
         }
       }
     }
+    _basisFunction.evaluate(radii.data(), rowVals, radii.size());
     ierr = MatSetValuesLocal(_matrixA, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
   }
   DEBUG("Finished filling Matrix A");
@@ -2,10 +2,19 @@
 
 #include "Mapping.hpp"
 #include "impl/BasisFunctions.hpp"
+#include "mesh/RTree.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/ThreadPool.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
 #include <Eigen/Core>
+#include <Eigen/Cholesky>
 #include <Eigen/QR>
+#include <Eigen/Sparse>
+#include <boost/function_output_iterator.hpp>
 
 namespace precice {
 namespace mapping {
@@ -20,6 +29,18 @@ namespace mapping {
  *
  * The radial basis function type has to be given as template parameter, and has
  * to be one of the defined types in this file.
+ *
+ * The interpolation matrix is assembled by a pool of threads, which is started
+ * once per mapping and has a single thread by default. For strictly positive
+ * definite basis functions, the system is solved by a Cholesky decomposition
+ * of the RBF block and the Schur complement of the polynomial block. Otherwise,
+ * or if the Cholesky decomposition fails, a pivoted QR decomposition of the
+ * whole interpolation matrix is used.
+ *
+ * For basis functions with compact support, the neighbors within the support
+ * radius are found using the vertex rtree. If the resulting matrices are
+ * sparse enough, they are assembled as Eigen::SparseMatrix and solved by a
+ * sparse Cholesky decomposition, or a sparse LU decomposition as fallback.
  */
 template<typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctMapping : public Mapping
@@ -33,6 +54,7 @@ public:
    * @param[in] dimension Dimensionality of the meshes
    * @param[in] function Radial basis function used for mapping.
    * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   * @param[in] threads Number of threads assembling the matrices, including the calling thread
    */
   RadialBasisFctMapping (
     Constraint              constraint,
@@ -40,7 +62,8 @@ public:
     RADIAL_BASIS_FUNCTION_T function,
     bool                    xDead,
     bool                    yDead,
-    bool                    zDead);
+    bool                    zDead,
+    int                     threads = 1);
 
 
   /// Computes the mapping coefficients from the in- and output mesh.
@@ -55,10 +78,16 @@ public:
   /// Maps input data to output data from input mesh to output mesh.
   virtual void map(int inputDataID, int outputDataID ) override;
 
+  /// Maps several data fields with one solve of the interpolation system for all of them.
+  virtual void map(const DataIDPairs& dataIDs) override;
+
   virtual void tagMeshFirstRound() override;
 
   virtual void tagMeshSecondRound() override;
 
+  /// Returns true, if the last computeMapping() assembled sparse matrices.
+  bool usesSparseMatrices() const { return _useSparse; }
+
 private:
 
   precice::logging::Logger _log{"mapping::RadialBasisFctMapping"};
@@ -68,16 +97,95 @@ private:
   /// Radial basis function type used in interpolation.
   RADIAL_BASIS_FUNCTION_T _basisFunction;
 
+  /// Threads assembling the matrices, kept for all computations of the mapping.
+  utils::ThreadPool _threadPool;
+
   Eigen::MatrixXd _matrixA;
 
+  /// Decomposition of the interpolation matrix C, if not solved by Cholesky
   Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qr;
-  
+
+  /// True, if the interpolation system is solved using _llt and _schurQR
+  bool _useCholesky = false;
+
+  /// Cholesky decomposition of the RBF block of the interpolation matrix C
+  Eigen::LLT<Eigen::MatrixXd, Eigen::Upper> _llt;
+
+  /// Inverse RBF block times polynomial block of C
+  Eigen::MatrixXd _matrixCinvP;
+
+  /// Decomposition of the Schur complement of the polynomial block
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _schurQR;
+
+  using SparseMatrix = Eigen::SparseMatrix<double>;
+
+  using Triplets = std::vector<Eigen::Triplet<double>>;
+
+  /// True, if the sparse matrices and decompositions are used
+  bool _useSparse = false;
+
+  /// Sparse evaluation matrix A, used instead of _matrixA
+  SparseMatrix _sparseMatrixA;
+
+  /// Sparse Cholesky decomposition of the RBF block of C, used instead of _llt
+  std::unique_ptr<Eigen::SimplicialLLT<SparseMatrix>> _sparseLLT;
+
+  /// Sparse LU decomposition of C, used instead of _qr
+  std::unique_ptr<Eigen::SparseLU<SparseMatrix>> _sparseLU;
+
+  /// Assembles _matrixA and decomposes the dense interpolation matrix C.
+  void computeDenseMapping (
+    const Eigen::MatrixXd& inCoords,
+    const Eigen::MatrixXd& outCoords );
+
+  /// Assembles _sparseMatrixA and decomposes the sparse interpolation matrix C.
+  void computeSparseMapping (
+    mesh::PtrMesh          inMesh,
+    const Eigen::MatrixXd& inCoords,
+    const mesh::Mesh&      outMesh,
+    const Eigen::MatrixXd& outCoords );
+
+  /// Estimates the fraction of nonzero entries of the RBF block of C from a sample of vertices.
+  double estimateFill (
+    mesh::PtrMesh          inMesh,
+    const Eigen::MatrixXd& inCoords );
+
+  /// Calls func(j, radius) for all input vertices j within the support radius of query vertex i.
+  template<typename FUNC_T>
+  void forEachWithinSupport (
+    const mesh::rtree::VertexRTree& tree,
+    const Eigen::MatrixXd&          inCoords,
+    const mesh::Mesh&               queryMesh,
+    const Eigen::MatrixXd&          queryCoords,
+    int                             i,
+    FUNC_T                          func );
+
+  /**
+   * @brief Evaluates the basis function for all pairs of query and input vertices within the support radius.
+   *
+   * @return Triplets (query vertex index, input vertex index, value)
+   */
+  Triplets evaluateWithinSupport (
+    mesh::PtrMesh          inMesh,
+    const Eigen::MatrixXd& inCoords,
+    const mesh::Mesh&      queryMesh,
+    const Eigen::MatrixXd& queryCoords );
+
+  /// Solves the interpolation system C X = rhs for all columns of rhs, using the decomposition of computeMapping().
+  Eigen::MatrixXd solve(const Eigen::MatrixXd& rhs) const;
+
+  /// Solves C X = rhs by block elimination of the polynomial, using a decomposition of the RBF block.
+  template<typename DECOMPOSITION_T>
+  Eigen::MatrixXd solveSchur (
+    const DECOMPOSITION_T& decomposition,
+    const Eigen::MatrixXd& rhs ) const;
+
+  /// Returns the coordinates of all vertices without dead directions, one column per vertex.
+  Eigen::MatrixXd reducedCoordinates(const mesh::Mesh& mesh);
+
   /// true if the mapping along some axis should be ignored
   std::vector<bool> _deadAxis;
 
-  /// Deletes all dead directions from fullVector and returns a vector of reduced dimensionality.
-  Eigen::VectorXd reduceVector(const Eigen::VectorXd& fullVector);
-  
   void setDeadAxis(bool xDead, bool yDead, bool zDead)
   {
     _deadAxis.resize(getDimensions());
@@ -111,10 +219,12 @@ RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: RadialBasisFctMapping
   RADIAL_BASIS_FUNCTION_T function,
   bool                    xDead,
   bool                    yDead,
-  bool                    zDead)
+  bool                    zDead,
+  int                     threads)
   :
   Mapping ( constraint, dimensions ),
-  _basisFunction ( function )
+  _basisFunction ( function ),
+  _threadPool ( threads )
 {
   setInputRequirement(VERTEX);
   setOutputRequirement(VERTEX);
@@ -145,63 +255,253 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: computeMapping()
     outMesh = output();
   }
   int inputSize = (int)inMesh->vertices().size();
-  int outputSize = (int)outMesh->vertices().size();
   int deadDimensions = 0;
   for (int d = 0; d < dimensions; d++) {
     if (_deadAxis[d]) deadDimensions +=1;
   }
   int polyparams = 1 + dimensions - deadDimensions;
   assertion(inputSize >= 1 + polyparams, inputSize);
+  Eigen::MatrixXd inCoords = reducedCoordinates(*inMesh);
+  Eigen::MatrixXd outCoords = reducedCoordinates(*outMesh);
+
+  // Sparse matrices pay off only for a small fill
+  const double maxSparseFill = 0.1;
+  _useSparse = false;
+  if (_basisFunction.hasCompactSupport()){
+    double fill = estimateFill(inMesh, inCoords);
+    _useSparse = fill <= maxSparseFill;
+    DEBUG("Estimated fill of RBF block of C: " << fill << ", use sparse matrices: " << _useSparse);
+  }
+
+  if (_useSparse){
+    computeSparseMapping(inMesh, inCoords, *outMesh, outCoords);
+  }
+  else {
+    computeDenseMapping(inCoords, outCoords);
+  }
+
+  _hasComputedMapping = true;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: computeDenseMapping
+(
+  const Eigen::MatrixXd& inCoords,
+  const Eigen::MatrixXd& outCoords )
+{
+  int inputSize = inCoords.cols();
+  int outputSize = outCoords.cols();
+  int polyparams = 1 + inCoords.rows();
   int n = inputSize + polyparams; // Add linear polynom degrees
   Eigen::MatrixXd matrixCLU(n, n);
   matrixCLU.setZero();
   _matrixA = Eigen::MatrixXd(outputSize, n);
-  _matrixA.setZero();
 
-  // Fill upper right part (due to symmetry) of _matrixCLU with values
-  int i = 0;
-  Eigen::VectorXd difference(dimensions);
-  for (const mesh::Vertex& iVertex : inMesh->vertices()) {
-    for (int j = iVertex.getID(); j < inputSize; j++) {
-      difference = iVertex.getCoords();
-      difference -= inMesh->vertices()[j].getCoords();
-      matrixCLU(i,j) = _basisFunction.evaluate(reduceVector(difference).norm());
+  // Fill upper right part (due to symmetry) of matrixCLU with values, column-wise
+  // for contiguous memory access of the threads
+  _threadPool.parallelFor(inputSize, [&](int j){
+    Eigen::VectorXd radii = (inCoords.leftCols(j+1).colwise() - inCoords.col(j)).colwise().norm();
+    _basisFunction.evaluate(radii.data(), matrixCLU.col(j).data(), j+1);
+  });
+  matrixCLU.block(0, inputSize, inputSize, 1).setOnes();
+  matrixCLU.block(0, inputSize+1, inputSize, polyparams-1) = inCoords.transpose();
+
+  // Fill _matrixA with values
+  _threadPool.parallelFor(inputSize, [&](int j){
+    Eigen::VectorXd radii = (outCoords.colwise() - inCoords.col(j)).colwise().norm();
+    _basisFunction.evaluate(radii.data(), _matrixA.col(j).data(), outputSize);
+  });
+  _matrixA.col(inputSize).setOnes();
+  _matrixA.rightCols(polyparams-1) = outCoords.transpose();
+
+  _useCholesky = false;
+  if (_basisFunction.isStrictlyPositiveDefinite()){
+    _llt.compute(matrixCLU.topLeftCorner(inputSize, inputSize));
+    _useCholesky = _llt.info() == Eigen::Success;
+    if (not _useCholesky){
+      DEBUG("Cholesky decomposition failed, falling back to QR decomposition");
     }
-    matrixCLU(i,inputSize) = 1.0;
-    for (int dim=0; dim < dimensions-deadDimensions; dim++) {
-      matrixCLU(i,inputSize+1+dim) = reduceVector(iVertex.getCoords())[dim];
+  }
+
+  if (_useCholesky){
+    DEBUG("Solve interpolation system with Cholesky decomposition");
+    const auto matrixP = matrixCLU.topRightCorner(inputSize, polyparams);
+    _matrixCinvP = _llt.solve(matrixP);
+    _schurQR = (matrixP.transpose() * _matrixCinvP).colPivHouseholderQr();
+    if (not _schurQR.isInvertible())
+      ERROR("Interpolation matrix C is not invertible.");
+  }
+  else {
+    DEBUG("Solve interpolation system with QR decomposition");
+    // Copy values of upper right part of C to lower left part
+    for (int i = 0; i < n; i++) {
+      for (int j = i+1; j < n; j++) {
+        matrixCLU(j,i) = matrixCLU(i,j);
+      }
+    }
+    _qr = matrixCLU.colPivHouseholderQr();
+    if (not _qr.isInvertible())
+      ERROR("Interpolation matrix C is not invertible.");
+  }
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: computeSparseMapping
+(
+  mesh::PtrMesh          inMesh,
+  const Eigen::MatrixXd& inCoords,
+  const mesh::Mesh&      outMesh,
+  const Eigen::MatrixXd& outCoords )
+{
+  int inputSize = inCoords.cols();
+  int outputSize = outCoords.cols();
+  int polyparams = 1 + inCoords.rows();
+  int n = inputSize + polyparams; // Add linear polynom degrees
+
+  Eigen::MatrixXd matrixP(inputSize, polyparams);
+  matrixP.col(0).setOnes();
+  matrixP.rightCols(polyparams-1) = inCoords.transpose();
+
+  Triplets triplets = evaluateWithinSupport(inMesh, inCoords, outMesh, outCoords);
+  triplets.reserve(triplets.size() + outputSize * polyparams);
+  for (int i = 0; i < outputSize; i++) {
+    triplets.emplace_back(i, inputSize, 1.0);
+    for (int dim = 0; dim < polyparams-1; dim++) {
+      triplets.emplace_back(i, inputSize+1+dim, outCoords(dim,i));
     }
-    i++;
   }
-  // Copy values of upper right part of C to lower left part
-  for (int i = 0; i < n; i++) {
-    for (int j = i+1; j < n; j++) {
-      matrixCLU(j,i) = matrixCLU(i,j);
+  _sparseMatrixA = SparseMatrix(outputSize, n);
+  _sparseMatrixA.setFromTriplets(triplets.begin(), triplets.end());
+
+  Triplets rbfTriplets = evaluateWithinSupport(inMesh, inCoords, *inMesh, inCoords);
+  SparseMatrix matrixC(inputSize, inputSize);
+  matrixC.setFromTriplets(rbfTriplets.begin(), rbfTriplets.end());
+
+  _useCholesky = false;
+  if (_basisFunction.isStrictlyPositiveDefinite()){
+    _sparseLLT.reset(new Eigen::SimplicialLLT<SparseMatrix>(matrixC));
+    _useCholesky = _sparseLLT->info() == Eigen::Success;
+    if (not _useCholesky){
+      DEBUG("Sparse Cholesky decomposition failed, falling back to sparse LU decomposition");
+      _sparseLLT.reset();
     }
   }
 
-  // Fill _matrixA with values
-  i = 0;
-  for (const mesh::Vertex& iVertex : outMesh->vertices()) {
-    int j = 0;
-    for (const mesh::Vertex& jVertex : inMesh->vertices()) {
-      difference = iVertex.getCoords();
-      difference -= jVertex.getCoords();
-      _matrixA(i,j) = _basisFunction.evaluate(reduceVector(difference).norm());
-      j++;
+  if (_useCholesky){
+    DEBUG("Solve interpolation system with sparse Cholesky decomposition");
+    _matrixCinvP = _sparseLLT->solve(matrixP);
+    _schurQR = (matrixP.transpose() * _matrixCinvP).colPivHouseholderQr();
+    if (not _schurQR.isInvertible())
+      ERROR("Interpolation matrix C is not invertible.");
+  }
+  else {
+    DEBUG("Solve interpolation system with sparse LU decomposition");
+    triplets = rbfTriplets;
+    for (int i = 0; i < inputSize; i++) {
+      for (int dim = 0; dim < polyparams; dim++) {
+        triplets.emplace_back(i, inputSize+dim, matrixP(i,dim));
+        triplets.emplace_back(inputSize+dim, i, matrixP(i,dim));
+      }
     }
-    _matrixA(i,inputSize) = 1.0;
-    for (int dim=0; dim < dimensions-deadDimensions; dim++) {
-      _matrixA(i,inputSize+1+dim) = reduceVector(iVertex.getCoords())[dim];
+    SparseMatrix matrixCLU(n, n);
+    matrixCLU.setFromTriplets(triplets.begin(), triplets.end());
+    matrixCLU.makeCompressed();
+    _sparseLU.reset(new Eigen::SparseLU<SparseMatrix>());
+    _sparseLU->compute(matrixCLU);
+    if (_sparseLU->info() != Eigen::Success)
+      ERROR("Interpolation matrix C is not invertible.");
+  }
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+typename RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::Triplets
+RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: evaluateWithinSupport
+(
+  mesh::PtrMesh          inMesh,
+  const Eigen::MatrixXd& inCoords,
+  const mesh::Mesh&      queryMesh,
+  const Eigen::MatrixXd& queryCoords )
+{
+  mesh::rtree::PtrRTree tree = mesh::rtree::getVertexRTree(inMesh);
+  std::vector<Triplets> tripletsPerVertex(queryCoords.cols());
+  _threadPool.parallelFor(queryCoords.cols(), [&](int i){
+    std::vector<int> indices;
+    std::vector<double> radii;
+    forEachWithinSupport(*tree, inCoords, queryMesh, queryCoords, i, [&](int j, double radius){
+      indices.push_back(j);
+      radii.push_back(radius);
+    });
+    std::vector<double> values(radii.size());
+    _basisFunction.evaluate(radii.data(), values.data(), radii.size());
+    tripletsPerVertex[i].reserve(indices.size());
+    for (size_t k = 0; k < indices.size(); k++) {
+      tripletsPerVertex[i].emplace_back(i, indices[k], values[k]);
     }
-    i++;
+  });
+
+  Triplets triplets;
+  size_t size = 0;
+  for (const Triplets& vertexTriplets : tripletsPerVertex) {
+    size += vertexTriplets.size();
   }
+  triplets.reserve(size);
+  for (const Triplets& vertexTriplets : tripletsPerVertex) {
+    triplets.insert(triplets.end(), vertexTriplets.begin(), vertexTriplets.end());
+  }
+  return triplets;
+}
 
-  _qr = matrixCLU.colPivHouseholderQr();
-  if (not _qr.isInvertible())
-    ERROR("Interpolation matrix C is not invertible.");
-  
-  _hasComputedMapping = true;
+template<typename RADIAL_BASIS_FUNCTION_T>
+double RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: estimateFill
+(
+  mesh::PtrMesh          inMesh,
+  const Eigen::MatrixXd& inCoords )
+{
+  const int maxSamples = 100;
+  int inputSize = inCoords.cols();
+  int stride = std::max(inputSize / maxSamples, 1);
+  mesh::rtree::PtrRTree tree = mesh::rtree::getVertexRTree(inMesh);
+  size_t nonzeros = 0;
+  int samples = 0;
+  for (int i = 0; i < inputSize; i += stride) {
+    forEachWithinSupport(*tree, inCoords, *inMesh, inCoords, i, [&](int, double){ nonzeros++; });
+    samples++;
+  }
+  return (double) nonzeros / ((double) samples * inputSize);
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+template<typename FUNC_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: forEachWithinSupport
+(
+  const mesh::rtree::VertexRTree& tree,
+  const Eigen::MatrixXd&          inCoords,
+  const mesh::Mesh&               queryMesh,
+  const Eigen::MatrixXd&          queryCoords,
+  int                             i,
+  FUNC_T                          func )
+{
+  double supportRadius = _basisFunction.getSupportRadius();
+  // Dead axes and non-existing dimensions do not restrict the search box
+  double lower[3] = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(),
+                     std::numeric_limits<double>::lowest()};
+  double upper[3] = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+                     std::numeric_limits<double>::max()};
+  const auto& coords = queryMesh.vertices()[i].getCoords();
+  for (int d = 0; d < getDimensions(); d++) {
+    if (not _deadAxis[d]) {
+      lower[d] = coords[d] - supportRadius;
+      upper[d] = coords[d] + supportRadius;
+    }
+  }
+  using Point = boost::geometry::point_type<mesh::Box3d>::type;
+  mesh::Box3d box(Point(lower[0], lower[1], lower[2]), Point(upper[0], upper[1], upper[2]));
+  tree.query(boost::geometry::index::intersects(box), boost::make_function_output_iterator([&](size_t j) {
+      double radius = (queryCoords.col(i) - inCoords.col(j)).norm();
+      if (radius < supportRadius) {
+        func(j, radius);
+      }
+    }));
 }
 
 template<typename RADIAL_BASIS_FUNCTION_T>
@@ -216,6 +516,14 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: clear()
   TRACE();
   _matrixA = Eigen::MatrixXd();
   _qr = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _llt = Eigen::LLT<Eigen::MatrixXd, Eigen::Upper>();
+  _matrixCinvP = Eigen::MatrixXd();
+  _schurQR = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _sparseMatrixA = SparseMatrix();
+  _sparseLLT.reset();
+  _sparseLU.reset();
+  _useCholesky = false;
+  _useSparse = false;
   _hasComputedMapping = false;
 }
 
@@ -226,69 +534,111 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
   int outputDataID )
 {
   TRACE(inputDataID, outputDataID);
+  map(DataIDPairs{{inputDataID, outputDataID}});
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
+(
+  const DataIDPairs& dataIDs )
+{
+  TRACE(dataIDs.size());
   assertion(_hasComputedMapping);
   assertion(input()->getDimensions() == output()->getDimensions(),
              input()->getDimensions(), output()->getDimensions());
   assertion(getDimensions() == output()->getDimensions(),
              getDimensions(), output()->getDimensions());
 
-  Eigen::VectorXd& inValues = input()->data(inputDataID)->values();
-  Eigen::VectorXd& outValues = output()->data(outputDataID)->values();
-  int valueDim = input()->data(inputDataID)->getDimensions();
-  assertion(valueDim == output()->data(outputDataID)->getDimensions(),
-             valueDim, output()->data(outputDataID)->getDimensions());
+  // Every component of every data field becomes one column of the right-hand side
+  int columns = 0;
+  for (const auto& ids : dataIDs) {
+    int valueDim = input()->data(ids.first)->getDimensions();
+    assertion(valueDim == output()->data(ids.second)->getDimensions(),
+              valueDim, output()->data(ids.second)->getDimensions());
+    columns += valueDim;
+  }
   int deadDimensions = 0;
   for (int d = 0; d < getDimensions(); d++) {
     if (_deadAxis[d]) deadDimensions +=1;
   }
   int polyparams = 1 + getDimensions() - deadDimensions;
+  int rowsA = _useSparse ? _sparseMatrixA.rows() : _matrixA.rows();
+  int colsA = _useSparse ? _sparseMatrixA.cols() : _matrixA.cols();
 
   if (getConstraint() == CONSERVATIVE){
     DEBUG("Map conservative");
     static int mappingIndex = 0;
-    Eigen::VectorXd Au(_matrixA.cols());  // rows == n
-    Eigen::VectorXd in(_matrixA.rows());  // rows == outputSize
-    Eigen::VectorXd out(_matrixA.cols()); // rows == n
-
-    // DEBUG("C rows=" << _matrixCLU.rows() << " cols=" << _matrixCLU.cols());
-    DEBUG("A rows=" << _matrixA.rows() << " cols=" << _matrixA.cols());
-    DEBUG("in size=" << in.size() << ", out size=" << out.size());
-
-    for (int dim = 0; dim < valueDim; dim++) {
-      for (int i = 0; i < in.size(); i++) { // Fill input data values
-        in[i] = inValues(i*valueDim + dim);
+    Eigen::MatrixXd in(rowsA, columns);  // rows == outputSize
+    Eigen::MatrixXd Au(colsA, columns);  // rows == n
+    Eigen::MatrixXd out(colsA, columns); // rows == n
+
+    DEBUG("A rows=" << rowsA << " cols=" << colsA);
+    DEBUG("in size=" << in.rows() << ", out size=" << out.rows() << ", columns=" << columns);
+
+    // Fill input from input data values
+    int column = 0;
+    for (const auto& ids : dataIDs) {
+      const Eigen::VectorXd& inValues = input()->data(ids.first)->values();
+      int valueDim = input()->data(ids.first)->getDimensions();
+      for (int dim = 0; dim < valueDim; dim++, column++) {
+        for (int i = 0; i < in.rows(); i++) {
+          in(i, column) = inValues(i*valueDim + dim);
+        }
       }
+    }
 
+    if (_useSparse)
+      Au = _sparseMatrixA.transpose() * in;
+    else
       Au = _matrixA.transpose() * in;
-      out = _qr.solve(Au);
-
-      // Copy mapped data to output data values
-      for (int i = 0; i < out.size()-polyparams; i++) {
-        outValues(i*valueDim + dim) = out[i];
+    out = solve(Au);
+
+    // Copy mapped data to output data values
+    column = 0;
+    for (const auto& ids : dataIDs) {
+      Eigen::VectorXd& outValues = output()->data(ids.second)->values();
+      int valueDim = output()->data(ids.second)->getDimensions();
+      for (int dim = 0; dim < valueDim; dim++, column++) {
+        for (int i = 0; i < out.rows()-polyparams; i++) {
+          outValues(i*valueDim + dim) = out(i, column);
+        }
       }
     }
     mappingIndex++;
   }
   else { // Map consistent
     DEBUG("Map consistent");
-    Eigen::VectorXd p(_matrixA.cols());    // rows == n
-    Eigen::VectorXd in(_matrixA.cols());   // rows == n
-    Eigen::VectorXd out(_matrixA.rows());  // rows == outputSize
-    in.setZero();
-
-    // For every data dimension, perform mapping
-    for (int dim = 0; dim < valueDim; dim++) {
-      // Fill input from input data values (last polyparams entries remain zero)
-      for (int i = 0; i < in.size() - polyparams; i++) {
-        in[i] = inValues(i*valueDim + dim);
+    Eigen::MatrixXd in = Eigen::MatrixXd::Zero(colsA, columns); // rows == n
+    Eigen::MatrixXd p(colsA, columns);   // rows == n
+    Eigen::MatrixXd out(rowsA, columns); // rows == outputSize
+
+    // Fill input from input data values (last polyparams rows remain zero)
+    int column = 0;
+    for (const auto& ids : dataIDs) {
+      const Eigen::VectorXd& inValues = input()->data(ids.first)->values();
+      int valueDim = input()->data(ids.first)->getDimensions();
+      for (int dim = 0; dim < valueDim; dim++, column++) {
+        for (int i = 0; i < in.rows() - polyparams; i++) {
+          in(i, column) = inValues(i*valueDim + dim);
+        }
       }
+    }
 
-      p = _qr.solve(in);
+    p = solve(in);
+    if (_useSparse)
+      out = _sparseMatrixA * p;
+    else
       out = _matrixA * p;
 
-      // Copy mapped data to ouptut data values
-      for (int i = 0; i < out.size(); i++) {
-        outValues(i*valueDim + dim) = out[i];
+    // Copy mapped data to ouptut data values
+    column = 0;
+    for (const auto& ids : dataIDs) {
+      Eigen::VectorXd& outValues = output()->data(ids.second)->values();
+      int valueDim = output()->data(ids.second)->getDimensions();
+      for (int dim = 0; dim < valueDim; dim++, column++) {
+        for (int i = 0; i < out.rows(); i++) {
+          outValues(i*valueDim + dim) = out(i, column);
+        }
       }
     }
   }
@@ -296,9 +646,44 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
 
 
 template<typename RADIAL_BASIS_FUNCTION_T>
-Eigen::VectorXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reduceVector
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::solve
+(
+  const Eigen::MatrixXd& rhs) const
+{
+  if (_useSparse){
+    if (_useCholesky)
+      return solveSchur(*_sparseLLT, rhs);
+    return _sparseLU->solve(rhs);
+  }
+  if (_useCholesky)
+    return solveSchur(_llt, rhs);
+  return _qr.solve(rhs);
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+template<typename DECOMPOSITION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::solveSchur
+(
+  const DECOMPOSITION_T& decomposition,
+  const Eigen::MatrixXd& rhs) const
+{
+  // Block elimination of [C P; P^T 0] [a; b] = [f; g] with S = P^T C^-1 P:
+  // b = S^-1 (P^T C^-1 f - g), a = C^-1 f - C^-1 P b
+  int inputSize = _matrixCinvP.rows();
+  int polyparams = rhs.rows() - inputSize;
+  Eigen::MatrixXd result(rhs.rows(), rhs.cols());
+  auto a = result.topRows(inputSize);
+  auto b = result.bottomRows(polyparams);
+  a = decomposition.solve(rhs.topRows(inputSize));
+  b = _schurQR.solve(_matrixCinvP.transpose() * rhs.topRows(inputSize) - rhs.bottomRows(polyparams));
+  a -= _matrixCinvP * b;
+  return result;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reducedCoordinates
 (
-  const Eigen::VectorXd& fullVector)
+  const mesh::Mesh& mesh)
 {
   int deadDimensions = 0;
   for (int d = 0; d < getDimensions(); d++) {
@@ -306,15 +691,19 @@ Eigen::VectorXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reduceVector
       deadDimensions +=1;
   }
   assertion(getDimensions()>deadDimensions, getDimensions(), deadDimensions);
-  Eigen::VectorXd reducedVector(getDimensions()-deadDimensions);
-  int k = 0;
-  for (int d = 0; d < getDimensions(); d++) {
-    if (not _deadAxis[d]) {
-      reducedVector[k] = fullVector[d];
-      k++;
+  Eigen::MatrixXd reducedCoords(getDimensions()-deadDimensions, mesh.vertices().size());
+  int i = 0;
+  for (const mesh::Vertex& vertex : mesh.vertices()) {
+    int k = 0;
+    for (int d = 0; d < getDimensions(); d++) {
+      if (not _deadAxis[d]) {
+        reducedCoords(k,i) = vertex.getCoords()[d];
+        k++;
+      }
     }
+    i++;
   }
-  return reducedVector;
+  return reducedCoords;
 }
 
 template<typename RADIAL_BASIS_FUNCTION_T>
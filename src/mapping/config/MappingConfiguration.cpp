@@ -61,6 +61,10 @@ MappingConfiguration:: MappingConfiguration
   XMLAttribute<bool> attrZDead(ATTR_Z_DEAD);
   attrZDead.setDocumentation("If set to true, the z axis will be ignored for the mapping");
   attrZDead.setDefaultValue(false);
+  XMLAttribute<int> attrThreads(ATTR_THREADS);
+  attrThreads.setDocumentation("Number of threads assembling the interpolation matrices. "
+                               "More than one thread pays off only if the participant has cores of its own.");
+  attrThreads.setDefaultValue(1);
   XMLAttribute<std::string> attrPolynomial("polynomial");
   attrPolynomial.setDocumentation("Toggles use of the global polynomial");
   attrPolynomial.setDefaultValue("separate");
@@ -74,39 +78,47 @@ MappingConfiguration:: MappingConfiguration
   std::list<XMLTag> tags;
   {
     XMLTag tag(*this, VALUE_RBF_TPS, occ, TAG);
+    tag.addAttribute(attrThreads);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_MULTIQUADRICS, occ, TAG);
+    tag.addAttribute(attrThreads);
     tag.addAttribute(attrShapeParam);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_INV_MULTIQUADRICS, occ, TAG);
+    tag.addAttribute(attrThreads);
     tag.addAttribute(attrShapeParam);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_VOLUME_SPLINES, occ, TAG);
+    tag.addAttribute(attrThreads);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_GAUSSIAN, occ, TAG);
+    tag.addAttribute(attrThreads);
     tag.addAttribute(attrShapeParam);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_CTPS_C2, occ, TAG);
+    tag.addAttribute(attrThreads);
     tag.addAttribute(attrSupportRadius);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_CPOLYNOMIAL_C0, occ, TAG);
+    tag.addAttribute(attrThreads);
     tag.addAttribute(attrSupportRadius);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_CPOLYNOMIAL_C6, occ, TAG);
+    tag.addAttribute(attrThreads);
     tag.addAttribute(attrSupportRadius);
     tags.push_back(tag);
   }
@@ -235,6 +247,7 @@ void MappingConfiguration:: xmlTagCallback
     double supportRadius = 0.0;
     double solverRtol = 1e-9;
     bool xDead = false, yDead = false, zDead = false;
+    int threads = 1;
     Polynomial polynomial = Polynomial::ON;
     Preallocation preallocation = Preallocation::OFF;
     
@@ -256,6 +269,11 @@ void MappingConfiguration:: xmlTagCallback
     if (tag.hasAttribute(ATTR_Z_DEAD)){
       zDead = tag.getBooleanAttributeValue(ATTR_Z_DEAD);
     }
+    if (tag.hasAttribute(ATTR_THREADS)){
+      threads = tag.getIntAttributeValue(ATTR_THREADS);
+      CHECK(threads >= 1, "Attribute \"" << ATTR_THREADS << "\" of mapping \"" << type
+            << "\" has to be at least 1, but is " << threads << "!");
+    }
     if (tag.hasAttribute("polynomial")) {
       std::string strPolynomial = tag.getStringAttributeValue("polynomial");
       if (strPolynomial == "separate")
@@ -280,7 +298,7 @@ void MappingConfiguration:: xmlTagCallback
     ConfiguredMapping configuredMapping = createMapping(dir, type, constraint,
                                                         fromMesh, toMesh, timing,
                                                         shapeParameter, supportRadius, solverRtol,
-                                                        xDead, yDead, zDead, polynomial, preallocation);
+                                                        xDead, yDead, zDead, threads, polynomial, preallocation);
     checkDuplicates ( configuredMapping );
     _mappings.push_back ( configuredMapping );
   }
@@ -329,6 +347,7 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping
   bool               xDead,
   bool               yDead,
   bool               zDead,
+  int                threads,
   Polynomial         polynomial,
   Preallocation      preallocation) const
 {
@@ -388,48 +407,48 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping
   else if (type == VALUE_RBF_TPS){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(),
-            xDead, yDead, zDead));
+            xDead, yDead, zDead, threads));
   }
   else if (type == VALUE_RBF_MULTIQUADRICS){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<Multiquadrics>(
         constraintValue, dimensions, Multiquadrics(shapeParameter),
-        xDead, yDead, zDead ));
+        xDead, yDead, zDead, threads ));
   }
   else if (type == VALUE_RBF_INV_MULTIQUADRICS){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<InverseMultiquadrics>(
         constraintValue, dimensions, InverseMultiquadrics(shapeParameter),
-        xDead, yDead, zDead ));
+        xDead, yDead, zDead, threads ));
   }
   else if (type == VALUE_RBF_VOLUME_SPLINES){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(),
-      xDead, yDead, zDead ));
+      xDead, yDead, zDead, threads ));
   }
   else if (type == VALUE_RBF_GAUSSIAN){
     configuredMapping.mapping = PtrMapping(
         new RadialBasisFctMapping<Gaussian>(
           constraintValue, dimensions, Gaussian(shapeParameter),
-          xDead, yDead, zDead));
+          xDead, yDead, zDead, threads));
   }
   else if (type == VALUE_RBF_CTPS_C2){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<CompactThinPlateSplinesC2>(
         constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius),
-        xDead, yDead, zDead ));
+        xDead, yDead, zDead, threads ));
   }
   else if (type == VALUE_RBF_CPOLYNOMIAL_C0){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<CompactPolynomialC0>(
         constraintValue, dimensions, CompactPolynomialC0(supportRadius),
-        xDead, yDead, zDead ));
+        xDead, yDead, zDead, threads ));
   }
   else if (type == VALUE_RBF_CPOLYNOMIAL_C6){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<CompactPolynomialC6>(
         constraintValue, dimensions, CompactPolynomialC6(supportRadius),
-        xDead, yDead, zDead ));
+        xDead, yDead, zDead, threads ));
   }
 # ifndef PRECICE_NO_PETSC
   else if (type == VALUE_PETRBF_TPS){
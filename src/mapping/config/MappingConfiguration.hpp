@@ -126,6 +126,7 @@ private:
   const std::string ATTR_X_DEAD = "x-dead";
   const std::string ATTR_Y_DEAD = "y-dead";
   const std::string ATTR_Z_DEAD = "z-dead";
+  const std::string ATTR_THREADS = "threads";
 
   const std::string VALUE_WRITE = "write";
   const std::string VALUE_READ = "read";
@@ -172,6 +173,7 @@ private:
     bool               xDead,
     bool               yDead,
     bool               zDead,
+    int                threads,
     Polynomial         polynomial,
     Preallocation      preallocation) const;
 
@@ -2,6 +2,15 @@
 
 #include "logging/Logger.hpp"
 #include "math/math.hpp"
+#include <algorithm>
+#include <Eigen/Core>
+
+/*
+ * All basis functions provide a scalar evaluate(radius) and a batch
+ * evaluate(radii, values, n), which evaluates n radii at once using
+ * Eigen array expressions. The latter is used for matrix assembly, since it
+ * allows the compiler to vectorize the evaluation.
+ */
 
 namespace precice {
 namespace mapping {
@@ -23,14 +32,24 @@ public:
   double getSupportRadius() const
   { return std::numeric_limits<double>::max(); }
 
+  bool isStrictlyPositiveDefinite() const
+  { return false; }
+
   double evaluate ( double radius ) const
   {
     double result = 0.0;
     if (math::greater(radius, 0.0)){
-      result = std::log(radius) * std::pow(radius, 2);
+      result = std::log(radius) * radius * radius;
     }
     return result;
   }
+
+  void evaluate ( const double* radii, double* values, size_t n ) const
+  {
+    Eigen::Map<const Eigen::ArrayXd> r(radii, n);
+    Eigen::Map<Eigen::ArrayXd>(values, n) =
+      (r > math::NUMERICAL_ZERO_DIFFERENCE).select(r.log() * r.square(), 0.0);
+  }
 };
 
 /**
@@ -53,9 +72,18 @@ public:
   double getSupportRadius() const
   { return std::numeric_limits<double>::max(); }
 
+  bool isStrictlyPositiveDefinite() const
+  { return false; }
+
   double evaluate ( double radius ) const
   {
-    return std::sqrt(_cPow2 + std::pow(radius, 2));
+    return std::sqrt(_cPow2 + radius * radius);
+  }
+
+  void evaluate ( const double* radii, double* values, size_t n ) const
+  {
+    Eigen::Map<const Eigen::ArrayXd> r(radii, n);
+    Eigen::Map<Eigen::ArrayXd>(values, n) = (r.square() + _cPow2).sqrt();
   }
 
 private:
@@ -88,9 +116,18 @@ public:
   double getSupportRadius() const
   { return std::numeric_limits<double>::max(); }
 
+  bool isStrictlyPositiveDefinite() const
+  { return true; }
+
   double evaluate ( double radius ) const
   {
-    return 1.0 / std::sqrt(_cPow2 + std::pow(radius, 2));
+    return 1.0 / std::sqrt(_cPow2 + radius * radius);
+  }
+
+  void evaluate ( const double* radii, double* values, size_t n ) const
+  {
+    Eigen::Map<const Eigen::ArrayXd> r(radii, n);
+    Eigen::Map<Eigen::ArrayXd>(values, n) = (r.square() + _cPow2).rsqrt();
   }
 
 private:
@@ -116,10 +153,18 @@ public:
   double getSupportRadius() const
   { return std::numeric_limits<double>::max(); }
 
+  bool isStrictlyPositiveDefinite() const
+  { return false; }
+
   double evaluate ( double radius ) const
   {
     return radius;
   }
+
+  void evaluate ( const double* radii, double* values, size_t n ) const
+  {
+    std::copy(radii, radii + n, values);
+  }
 };
 
 /**
@@ -152,12 +197,22 @@ public:
 
   double getSupportRadius() const { return _supportRadius; }
 
+  bool isStrictlyPositiveDefinite() const
+  { return true; }
+
   double evaluate(const double radius) const
   {
     if (radius > _supportRadius)
       return 0;
     else
-      return std::exp( - std::pow(_shape*radius,2.0) ) - _deltaY;
+      return std::exp( - (_shape*radius) * (_shape*radius) ) - _deltaY;
+  }
+
+  void evaluate ( const double* radii, double* values, size_t n ) const
+  {
+    Eigen::Map<const Eigen::ArrayXd> r(radii, n);
+    Eigen::Map<Eigen::ArrayXd>(values, n) =
+      (r > _supportRadius).select(0.0, (-(_shape * r).square()).exp() - _deltaY);
   }
 
 private:
@@ -182,8 +237,9 @@ private:
  * Takes the support radius (> 0.0) on construction.
  *
  *
- * Evaluates to: 1 - 30*rn^2 - 10*rn^3 + 45*rn^4 - 6*rn^5 - 60*log(rn^3),
+ * Evaluates to: 1 - 30*rn^2 - 10*rn^3 + 45*rn^4 - 6*rn^5 - 60*log(rn^(rn^3)),
  * where rn is the radius r normalized over the support radius sr: rn = r/sr.
+ * The last term is evaluated as -60*rn^3*log(rn), which vanishes for rn = 0.
  */
 class CompactThinPlateSplinesC2
 {
@@ -202,14 +258,26 @@ public:
   double getSupportRadius() const
   { return _r; }
 
+  bool isStrictlyPositiveDefinite() const
+  { return true; }
+
   double evaluate ( double radius ) const
   {
     if (radius >= _r) return 0.0;
     double p = radius / _r;
-    using std::pow;
-    using std::log;
-    return 1.0 - 30.0*pow(p,2.0) - 10.0*pow(p,3.0) + 45.0*pow(p,4.0)
-      - 6.0*pow(p,5.0) - 60.0*log(pow(p,pow(p,3.0)));
+    double result = 1.0 + p*p * (-30.0 + p * (-10.0 + p * (45.0 - 6.0*p)));
+    if (p > 0.0)
+      result -= 60.0 * p*p*p * std::log(p);
+    return result;
+  }
+
+  void evaluate ( const double* radii, double* values, size_t n ) const
+  {
+    Eigen::Map<const Eigen::ArrayXd> r(radii, n);
+    Eigen::ArrayXd p = r / _r;
+    Eigen::ArrayXd logTerm = (p > 0.0).select(60.0 * p.cube() * p.log(), 0.0);
+    Eigen::Map<Eigen::ArrayXd>(values, n) = (r >= _r).select(0.0,
+      1.0 + p.square() * (-30.0 + p * (-10.0 + p * (45.0 - 6.0*p))) - logTerm);
   }
 
 private:
@@ -245,10 +313,20 @@ public:
   double getSupportRadius() const
   { return _r; }
 
+  bool isStrictlyPositiveDefinite() const
+  { return true; }
+
   double evaluate ( double radius ) const
   {
     if (radius >= _r) return 0.0;
-    return std::pow(1.0 - radius/_r, 2.0);
+    double q = 1.0 - radius/_r;
+    return q * q;
+  }
+
+  void evaluate ( const double* radii, double* values, size_t n ) const
+  {
+    Eigen::Map<const Eigen::ArrayXd> r(radii, n);
+    Eigen::Map<Eigen::ArrayXd>(values, n) = (r >= _r).select(0.0, (1.0 - r/_r).square());
   }
 
 private:
@@ -284,12 +362,25 @@ public:
   double getSupportRadius() const
   { return _r; }
 
+  bool isStrictlyPositiveDefinite() const
+  { return true; }
+
   double evaluate ( double radius ) const
   {
     if (radius >= _r) return 0.0;
     double p = radius / _r;
-    using std::pow;
-    return pow(1.0-p,8.0) * (32.0*pow(p,3.0) + 25.0*pow(p,2.0) + 8.0*p + 1.0);
+    double q2 = (1.0-p) * (1.0-p);
+    double q4 = q2 * q2;
+    return q4 * q4 * (1.0 + p * (8.0 + p * (25.0 + p * 32.0)));
+  }
+
+  void evaluate ( const double* radii, double* values, size_t n ) const
+  {
+    Eigen::Map<const Eigen::ArrayXd> r(radii, n);
+    Eigen::ArrayXd p = r / _r;
+    Eigen::ArrayXd q4 = (1.0 - p).square().square();
+    Eigen::Map<Eigen::ArrayXd>(values, n) = (r >= _r).select(0.0,
+      q4.square() * (1.0 + p * (8.0 + p * (25.0 + p * 32.0))));
   }
 
 private:
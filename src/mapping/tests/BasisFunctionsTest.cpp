@@ -0,0 +1,51 @@
+#include "testing/Testing.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include <vector>
+
+using namespace precice::mapping;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(BasisFunctions)
+
+/// Checks that the batch evaluation equals the scalar evaluation, including radius zero and radii beyond the support.
+template<typename FUNCTION_T>
+void testBatchEvaluation(const FUNCTION_T& function)
+{
+  std::vector<double> radii;
+  for (int i = 0; i <= 40; i++) {
+    radii.push_back(i * 0.05);
+  }
+  std::vector<double> values(radii.size());
+  function.evaluate(radii.data(), values.data(), radii.size());
+  for (size_t i = 0; i < radii.size(); i++) {
+    BOOST_TEST(values[i] == function.evaluate(radii[i]));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BatchEvaluation)
+{
+  testBatchEvaluation(ThinPlateSplines());
+  testBatchEvaluation(Multiquadrics(0.5));
+  testBatchEvaluation(InverseMultiquadrics(0.5));
+  testBatchEvaluation(VolumeSplines());
+  testBatchEvaluation(Gaussian(2.0));
+  testBatchEvaluation(Gaussian(2.0, 1.0));
+  testBatchEvaluation(CompactThinPlateSplinesC2(1.2));
+  testBatchEvaluation(CompactPolynomialC0(1.2));
+  testBatchEvaluation(CompactPolynomialC6(1.2));
+}
+
+BOOST_AUTO_TEST_CASE(ScalarEvaluation)
+{
+  double p = 0.5 / 1.2;
+  BOOST_TEST(CompactPolynomialC6(1.2).evaluate(0.5) ==
+             std::pow(1.0-p, 8.0) * (32.0*std::pow(p, 3.0) + 25.0*std::pow(p, 2.0) + 8.0*p + 1.0));
+  BOOST_TEST(CompactThinPlateSplinesC2(1.2).evaluate(0.5) ==
+             1.0 - 30.0*std::pow(p, 2.0) - 10.0*std::pow(p, 3.0) + 45.0*std::pow(p, 4.0)
+             - 6.0*std::pow(p, 5.0) - 60.0*std::log(std::pow(p, std::pow(p, 3.0))));
+  BOOST_TEST(CompactThinPlateSplinesC2(1.2).evaluate(0.0) == 1.0);
+  BOOST_TEST(CompactPolynomialC6(1.2).evaluate(1.2) == 0.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -153,6 +153,152 @@ BOOST_AUTO_TEST_CASE(MapCompactPolynomialC6)
   perform3DTestConservativeMapping(conservativeMap3D);
 }
 
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC6Sparse)
+{
+  // Small support radius on a fine grid, such that sparse matrices are used
+  int dimensions = 2;
+  CompactPolynomialC6 fct(0.1);
+  auto linear = [](const Eigen::VectorXd& x){ return 1.0 + 2.0*x[0] + 3.0*x[1]; };
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false));
+  mesh::PtrData inData = inMesh->createData("InData", 1);
+  for (int i = 0; i < 30; i++) {
+    for (int j = 0; j < 30; j++) {
+      inMesh->createVertex(Eigen::Vector2d(i/29.0, j/29.0));
+    }
+  }
+  inMesh->allocateDataValues();
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false));
+  mesh::PtrData outData = outMesh->createData("OutData", 1);
+  for (int i = 0; i < 20; i++) {
+    for (int j = 0; j < 20; j++) {
+      outMesh->createVertex(Eigen::Vector2d(0.01 + i/20.0, 0.02 + j/20.0));
+    }
+  }
+  outMesh->allocateDataValues();
+
+  // Linear polynomials are reproduced exactly by a consistent mapping
+  RadialBasisFctMapping<CompactPolynomialC6> consistentMap(Mapping::CONSISTENT, dimensions, fct, false, false, false);
+  for (const mesh::Vertex& vertex : inMesh->vertices()) {
+    inData->values()[vertex.getID()] = linear(vertex.getCoords());
+  }
+  consistentMap.setMeshes(inMesh, outMesh);
+  consistentMap.computeMapping();
+  BOOST_TEST(consistentMap.usesSparseMatrices());
+  consistentMap.map(inData->getID(), outData->getID());
+  for (const mesh::Vertex& vertex : outMesh->vertices()) {
+    BOOST_TEST(outData->values()[vertex.getID()] == linear(vertex.getCoords()),
+               boost::test_tools::tolerance(1e-8));
+  }
+
+  // A conservative mapping preserves the sum of the values
+  RadialBasisFctMapping<CompactPolynomialC6> conservativeMap(Mapping::CONSERVATIVE, dimensions, fct, false, false, false);
+  outData->values().setConstant(1.0);
+  conservativeMap.setMeshes(outMesh, inMesh);
+  conservativeMap.computeMapping();
+  BOOST_TEST(conservativeMap.usesSparseMatrices());
+  conservativeMap.map(outData->getID(), inData->getID());
+  BOOST_TEST(inData->values().sum() == outData->values().sum(), boost::test_tools::tolerance(1e-8));
+}
+
+BOOST_AUTO_TEST_CASE(MapMultipleData)
+{
+  // Mapping several data fields at once gives the same values as mapping them one by one
+  int dimensions = 2;
+  Gaussian fct(5.0);
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false));
+  mesh::PtrData inScalar = inMesh->createData("InScalar", 1);
+  mesh::PtrData inVector = inMesh->createData("InVector", 2);
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 4; j++) {
+      inMesh->createVertex(Eigen::Vector2d(i/4.0, j/3.0));
+    }
+  }
+  inMesh->allocateDataValues();
+  inScalar->values() = Eigen::VectorXd::LinSpaced(inScalar->values().size(), 1.0, 3.0);
+  inVector->values() = Eigen::VectorXd::LinSpaced(inVector->values().size(), -2.0, 5.0).array().square();
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false));
+  mesh::PtrData outScalar = outMesh->createData("OutScalar", 1);
+  mesh::PtrData outVector = outMesh->createData("OutVector", 2);
+  mesh::PtrData outScalarSingle = outMesh->createData("OutScalarSingle", 1);
+  mesh::PtrData outVectorSingle = outMesh->createData("OutVectorSingle", 2);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      outMesh->createVertex(Eigen::Vector2d(0.1 + i/3.0, 0.2 + j/3.0));
+    }
+  }
+  outMesh->allocateDataValues();
+
+  for (Mapping::Constraint constraint : {Mapping::CONSISTENT, Mapping::CONSERVATIVE}) {
+    RadialBasisFctMapping<Gaussian> mapping(constraint, dimensions, fct, false, false, false);
+    mesh::PtrMesh from = constraint == Mapping::CONSISTENT ? inMesh : outMesh;
+    mesh::PtrMesh to = constraint == Mapping::CONSISTENT ? outMesh : inMesh;
+    mapping.setMeshes(from, to);
+    mapping.computeMapping();
+    if (constraint == Mapping::CONSISTENT) {
+      mapping.map({{inScalar->getID(), outScalar->getID()}, {inVector->getID(), outVector->getID()}});
+      mapping.map(inScalar->getID(), outScalarSingle->getID());
+      mapping.map(inVector->getID(), outVectorSingle->getID());
+      BOOST_TEST(testing::equals(outScalar->values(), outScalarSingle->values(), 1e-10));
+      BOOST_TEST(testing::equals(outVector->values(), outVectorSingle->values(), 1e-10));
+    }
+    else {
+      Eigen::VectorXd scalar, vector;
+      mapping.map({{outScalarSingle->getID(), inScalar->getID()}, {outVectorSingle->getID(), inVector->getID()}});
+      scalar = inScalar->values();
+      vector = inVector->values();
+      mapping.map(outScalarSingle->getID(), inScalar->getID());
+      mapping.map(outVectorSingle->getID(), inVector->getID());
+      BOOST_TEST(testing::equals(scalar, inScalar->values(), 1e-10));
+      BOOST_TEST(testing::equals(vector, inVector->values(), 1e-10));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MapWithThreads)
+{
+  // Several threads assemble the same matrices as a single thread, also when the mapping is recomputed
+  int dimensions = 2;
+  Gaussian fct(5.0);
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false));
+  mesh::PtrData inData = inMesh->createData("InData", 1);
+  for (int i = 0; i < 10; i++) {
+    for (int j = 0; j < 10; j++) {
+      inMesh->createVertex(Eigen::Vector2d(i/9.0, j/9.0));
+    }
+  }
+  inMesh->allocateDataValues();
+  inData->values() = Eigen::VectorXd::LinSpaced(inData->values().size(), 1.0, 3.0).array().square();
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false));
+  mesh::PtrData outDataSerial = outMesh->createData("OutDataSerial", 1);
+  mesh::PtrData outDataThreads = outMesh->createData("OutDataThreads", 1);
+  for (int i = 0; i < 7; i++) {
+    for (int j = 0; j < 7; j++) {
+      outMesh->createVertex(Eigen::Vector2d(0.05 + i/7.0, 0.03 + j/7.0));
+    }
+  }
+  outMesh->allocateDataValues();
+
+  RadialBasisFctMapping<Gaussian> serialMap(Mapping::CONSISTENT, dimensions, fct, false, false, false);
+  serialMap.setMeshes(inMesh, outMesh);
+  serialMap.computeMapping();
+  serialMap.map(inData->getID(), outDataSerial->getID());
+
+  RadialBasisFctMapping<Gaussian> threadsMap(Mapping::CONSISTENT, dimensions, fct, false, false, false, 3);
+  threadsMap.setMeshes(inMesh, outMesh);
+  for (int i = 0; i < 2; i++) {
+    threadsMap.clear();
+    threadsMap.computeMapping();
+    threadsMap.map(inData->getID(), outDataThreads->getID());
+    BOOST_TEST(testing::equals(outDataThreads->values(), outDataSerial->values()));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(DeadAxis2D)
 {
   int dimensions = 2;
@@ -66,6 +66,8 @@ public:
   double getEnclosingRadius () const;
 
 private:
+  /// Allows the mesh to renumber its elements, see Mesh::retain().
+  friend class Mesh;
 
   /// Pointers to Vertex objects defining the edge.
   std::array<Vertex*,2> _vertices;
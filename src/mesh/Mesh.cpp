@@ -7,6 +7,7 @@
 #include "math/math.hpp"
 #include <Eigen/Core>
 #include <Eigen/Geometry>
+#include <algorithm>
 #include "RTree.hpp"
 
 namespace precice {
@@ -121,9 +122,22 @@ Edge& Mesh:: createEdge
   Edge* newEdge = new Edge(vertexOne, vertexTwo, _manageEdgeIDs.getFreeID());
   newEdge->addParent(*this);
   _content.add(newEdge);
+  _edgeIndex.emplace(std::minmax(vertexOne.getID(), vertexTwo.getID()), newEdge);
   return *newEdge;
 }
 
+Edge* Mesh:: findEdge
+(
+  int vertexOneID,
+  int vertexTwoID )
+{
+  auto iter = _edgeIndex.find(std::minmax(vertexOneID, vertexTwoID));
+  if (iter == _edgeIndex.end()) {
+    return nullptr;
+  }
+  return iter->second;
+}
+
 Triangle& Mesh:: createTriangle
 (
   Edge& edgeOne,
@@ -504,6 +518,7 @@ void Mesh:: computeState()
     
 void Mesh:: clear()
 {
+  _content.quads().deleteElements();
   _content.triangles().deleteElements();
   _content.edges().deleteElements();
   _content.vertices().deleteElements();
@@ -511,7 +526,9 @@ void Mesh:: clear()
 
   _content.clear();
   _propertyContainers.clear();
+  _edgeIndex.clear();
 
+  _manageQuadIDs.resetIDs();
   _manageTriangleIDs.resetIDs();
   _manageEdgeIDs.resetIDs();
   _manageVertexIDs.resetIDs();
@@ -524,6 +541,114 @@ void Mesh:: clear()
 }
 
 
+namespace {
+
+/// Returns the size of an array that can be indexed by the IDs of all elements.
+template<typename Container>
+size_t idRange(const Container &elements)
+{
+  int maxID = -1;
+  for (const auto &element : elements) {
+    maxID = std::max(maxID, element.getID());
+  }
+  return maxID + 1;
+}
+
+} // namespace
+
+template<typename Container>
+void Mesh:: compactElements(
+    Container&              elements,
+    const std::vector<int>& newIDs)
+{
+  std::vector<typename Container::value_type*> retained;
+  retained.reserve(elements.size());
+  for (auto &element : elements) {
+    int newID = newIDs[element.getID()];
+    if (newID == -1) {
+      delete &element;
+    } else {
+      element._id = newID;
+      retained.push_back(&element);
+    }
+  }
+  elements.clear();
+  for (auto element : retained) {
+    elements.push_back(element);
+  }
+}
+
+void Mesh:: retain(
+    const std::function<bool(const Vertex&)>& predicate)
+{
+  TRACE();
+
+  // Flat remap arrays from old to new IDs, -1 marks removed elements
+  std::vector<int> newVertexIDs(idRange(vertices()), -1);
+  int              vertexCount = 0;
+  for (const Vertex& vertex : vertices()) {
+    if (predicate(vertex))
+      newVertexIDs[vertex.getID()] = vertexCount++;
+  }
+
+  std::vector<int> newEdgeIDs(idRange(edges()), -1);
+  int              edgeCount = 0;
+  for (const Edge& edge : edges()) {
+    if (newVertexIDs[edge.vertex(0).getID()] != -1 &&
+        newVertexIDs[edge.vertex(1).getID()] != -1)
+      newEdgeIDs[edge.getID()] = edgeCount++;
+  }
+
+  std::vector<int> newTriangleIDs(idRange(triangles()), -1);
+  int              triangleCount = 0;
+  for (const Triangle& triangle : triangles()) {
+    if (newEdgeIDs[triangle.edge(0).getID()] != -1 &&
+        newEdgeIDs[triangle.edge(1).getID()] != -1 &&
+        newEdgeIDs[triangle.edge(2).getID()] != -1)
+      newTriangleIDs[triangle.getID()] = triangleCount++;
+  }
+
+  std::vector<int> newQuadIDs(idRange(quads()), -1);
+  int              quadCount = 0;
+  for (const Quad& quad : quads()) {
+    if (newEdgeIDs[quad.edge(0).getID()] != -1 &&
+        newEdgeIDs[quad.edge(1).getID()] != -1 &&
+        newEdgeIDs[quad.edge(2).getID()] != -1 &&
+        newEdgeIDs[quad.edge(3).getID()] != -1)
+      newQuadIDs[quad.getID()] = quadCount++;
+  }
+
+  // Delete from top to bottom, such that no element refers to a deleted one
+  compactElements(_content.quads(), newQuadIDs);
+  compactElements(_content.triangles(), newTriangleIDs);
+  compactElements(_content.edges(), newEdgeIDs);
+  compactElements(_content.vertices(), newVertexIDs);
+
+  _edgeIndex.clear();
+  for (Edge& edge : edges()) {
+    _edgeIndex.emplace(std::minmax(edge.vertex(0).getID(), edge.vertex(1).getID()), &edge);
+  }
+
+  _manageVertexIDs.resetIDs();
+  for (int id = 0; id < vertexCount; id++)
+    _manageVertexIDs.insertID(id);
+  _manageEdgeIDs.resetIDs();
+  for (int id = 0; id < edgeCount; id++)
+    _manageEdgeIDs.insertID(id);
+  _manageTriangleIDs.resetIDs();
+  for (int id = 0; id < triangleCount; id++)
+    _manageTriangleIDs.insertID(id);
+  _manageQuadIDs.resetIDs();
+  for (int id = 0; id < quadCount; id++)
+    _manageQuadIDs.insertID(id);
+
+  meshChanged(*this);
+
+  for (mesh::PtrData data : _data) {
+    data->values().resize(0);
+  }
+}
+
 void Mesh:: addMesh(
     Mesh& deltaMesh)
 {
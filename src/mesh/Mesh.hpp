@@ -7,10 +7,13 @@
 #include "utils/PointerVector.hpp"
 #include "utils/ManageUniqueIDs.hpp"
 #include <boost/noncopyable.hpp>
+#include <functional>
 #include <map>
 #include <list>
 #include <vector>
+#include <unordered_map>
 #include <boost/signals2.hpp>
+#include <boost/functional/hash.hpp>
 
 namespace precice {
   namespace mesh {
@@ -136,6 +139,16 @@ public:
     Vertex& vertexOne,
     Vertex& vertexTwo );
 
+  /**
+   * @brief Returns the edge connecting the vertices with given IDs, or nullptr.
+   *
+   * The order of the vertex IDs does not matter. The lookup is done in an
+   * index which is maintained by createEdge().
+   */
+  Edge* findEdge (
+    int vertexOneID,
+    int vertexTwoID );
+
   /**
    * @brief Creates and initializes a Triangle object.
    *
@@ -235,6 +248,16 @@ public:
    */
   void clear();
 
+  /**
+   * @brief Removes all vertices for which the predicate is false, in place.
+   *
+   * Edges, triangles and quads are kept, if all their vertices resp. edges are kept.
+   * The remaining elements keep their order and are renumbered consecutively, i.e.,
+   * the mesh looks as if it was cleared and the remaining elements were created anew.
+   * As in clear(), data values are removed. meshChanged is emitted once.
+   */
+  void retain(const std::function<bool(const Vertex &)> &predicate);
+
   /// Returns a mapping from rank to used (not necessarily owned) vertex IDs
   VertexDistribution & getVertexDistribution()
   {
@@ -308,6 +331,13 @@ private:
   /// Data hold by the vertices of the mesh.
   DataContainer _data;
 
+  /// Edges indexed by the (ascending) IDs of their vertices.
+  std::unordered_map<std::pair<int,int>, Edge*, boost::hash<std::pair<int,int>>> _edgeIndex;
+
+  /// Deletes all elements with newIDs[ID] == -1 and assigns the new IDs to the others.
+  template<typename Container>
+  static void compactElements(Container &elements, const std::vector<int> &newIDs);
+
   utils::ManageUniqueIDs _manageVertexIDs;
 
   utils::ManageUniqueIDs _manageEdgeIDs;
@@ -6,6 +6,8 @@ namespace precice
 namespace mesh
 {
 
+logging::Logger PropertyContainer::_log("mesh::PropertyContainer");
+
 const int PropertyContainer::INDEX_GEOMETRY_ID = getFreePropertyID();
 
 std::unique_ptr<utils::ManageUniqueIDs> PropertyContainer::_manageUniqueIDs;
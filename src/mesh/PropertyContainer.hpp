@@ -115,7 +115,7 @@ public:
   void getProperties(int propertyID, std::vector<value_t> &properties);
 
 private:
-  mutable logging::Logger _log{"mesh::PropertyContainer"};
+  static logging::Logger _log;
 
   /// Manager to ensure unique identification of all properties.
   static std::unique_ptr<utils::ManageUniqueIDs> _manageUniqueIDs;
@@ -98,6 +98,9 @@ public:
   double getEnclosingRadius() const;
 
 private:
+  /// Allows the mesh to renumber its elements, see Mesh::retain().
+  friend class Mesh;
+
   /// Edges defining the quad.
   std::array<Edge *, 4> _edges;
 
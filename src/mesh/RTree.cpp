@@ -1,33 +1,92 @@
 #include "RTree.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Quad.hpp"
 
 namespace precice {
 namespace mesh {
 
 // Initialize static member
 std::map<int, rtree::PtrRTree> precice::mesh::rtree::trees;
+std::map<int, rtree::PtrPrimitiveRTree> precice::mesh::rtree::edgeTrees;
+std::map<int, rtree::PtrPrimitiveRTree> precice::mesh::rtree::triangleTrees;
+std::map<int, rtree::PtrPrimitiveRTree> precice::mesh::rtree::quadTrees;
+
+namespace {
+
+/// Returns the cached tree of the primitives or builds it, using the packing algorithm of boost.geometry
+template<typename Container>
+rtree::PtrPrimitiveRTree getPrimitiveRTree(
+  std::map<int, rtree::PtrPrimitiveRTree> & cache,
+  int                                       meshID,
+  Container const &                         primitives,
+  int                                       verticesPerPrimitive)
+{
+  namespace bg = boost::geometry;
+  auto iter = cache.find(meshID);
+  // Primitives may have been added to the mesh since the tree was cached
+  if (iter != cache.end() and iter->second->size() == primitives.size())
+    return iter->second;
+
+  std::vector<rtree::PrimitiveBox> boxes;
+  boxes.reserve(primitives.size());
+  for (size_t i = 0; i < primitives.size(); ++i) {
+    Box3d box = bg::make_inverse<Box3d>();
+    for (int j = 0; j < verticesPerPrimitive; ++j) {
+      bg::expand(box, primitives[i].vertex(j));
+    }
+    boxes.emplace_back(box, i);
+  }
+
+  auto tree = std::make_shared<rtree::PrimitiveRTree>(boxes);
+  cache[meshID] = tree;
+  return tree;
+}
+
+}
 
 rtree::PtrRTree rtree::getVertexRTree(PtrMesh mesh)
 {
+  auto iter = trees.find(mesh->getID());
+  // Vertices may have been added to the mesh since the tree was cached
+  if (iter != trees.end() and iter->second->size() == mesh->vertices().size())
+    return iter->second;
+
   RTreeParameters params;
   VertexIndexGetter ind(mesh->vertices());
-    
-  auto result = trees.emplace(std::piecewise_construct,
-                              std::forward_as_tuple(mesh->getID()),
-                              std::forward_as_tuple(std::make_shared<VertexRTree>(params, ind)));
-    
-  PtrRTree tree = std::get<0>(result)->second;
-    
-  if (std::get<1>(result)) // insertion took place, fill tree
-    for (size_t i = 0; i < mesh->vertices().size(); ++i)
-      tree->insert(i);
-    
+  auto tree = std::make_shared<VertexRTree>(params, ind);
+  for (size_t i = 0; i < mesh->vertices().size(); ++i)
+    tree->insert(i);
+
+  trees[mesh->getID()] = tree;
   return tree;
 }
 
 
+rtree::PtrPrimitiveRTree rtree::getEdgeRTree(PtrMesh mesh)
+{
+  return getPrimitiveRTree(edgeTrees, mesh->getID(), mesh->edges(), 2);
+}
+
+
+rtree::PtrPrimitiveRTree rtree::getTriangleRTree(PtrMesh mesh)
+{
+  return getPrimitiveRTree(triangleTrees, mesh->getID(), mesh->triangles(), 3);
+}
+
+
+rtree::PtrPrimitiveRTree rtree::getQuadRTree(PtrMesh mesh)
+{
+  return getPrimitiveRTree(quadTrees, mesh->getID(), mesh->quads(), 4);
+}
+
+
 void rtree::clear(Mesh & mesh)
 {
   trees.erase(mesh.getID());
+  edgeTrees.erase(mesh.getID());
+  triangleTrees.erase(mesh.getID());
+  quadTrees.erase(mesh.getID());
 }
 
 
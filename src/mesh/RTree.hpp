@@ -16,6 +16,8 @@ struct CacheClearing;
 namespace precice {
 namespace mesh {
 
+using Box3d = boost::geometry::model::box<boost::geometry::model::point<double, 3, boost::geometry::cs::cartesian>>;
+
 class rtree {
 public:
   using VertexIndexGetter = impl::PtrVectorIndexable<Mesh::VertexContainer>;
@@ -25,23 +27,51 @@ public:
                                                           VertexIndexGetter>;
   using PtrRTree = std::shared_ptr<VertexRTree>;
 
+  /// Bounding box of a mesh primitive (edge, triangle or quad) paired with its index in the mesh container
+  using PrimitiveBox      = std::pair<Box3d, size_t>;
+  using PrimitiveRTree    = boost::geometry::index::rtree<PrimitiveBox, RTreeParameters>;
+  using PtrPrimitiveRTree = std::shared_ptr<PrimitiveRTree>;
+
   /// Returns the pointer to boost::geometry::rtree for the given mesh
   /*
-   * Creates and fills the tree, if it wasn't requested before, otherwise it returns the cached tree.
+   * Creates and fills the tree, if it wasn't requested before or vertices were added since,
+   * otherwise it returns the cached tree.
    */
   static PtrRTree getVertexRTree(PtrMesh mesh);
+
+  /// Returns the tree of the bounding boxes of all edges of the given mesh
+  /*
+   * Creates and fills the tree, if it wasn't requested before, otherwise it returns the cached tree.
+   */
+  static PtrPrimitiveRTree getEdgeRTree(PtrMesh mesh);
+
+  /// Returns the tree of the bounding boxes of all triangles of the given mesh
+  /*
+   * Creates and fills the tree, if it wasn't requested before, otherwise it returns the cached tree.
+   */
+  static PtrPrimitiveRTree getTriangleRTree(PtrMesh mesh);
+
+  /// Returns the tree of the bounding boxes of all quads of the given mesh
+  /*
+   * Creates and fills the tree, if it wasn't requested before, otherwise it returns the cached tree.
+   */
+  static PtrPrimitiveRTree getQuadRTree(PtrMesh mesh);
   
-  /// Only clear the tree of that specific mesh
+  /// Only clear the trees of that specific mesh
   static void clear(Mesh & mesh);
 
   friend struct MeshTests::RTree::CacheClearing;
   
 private:
   static std::map<int, PtrRTree> trees;
-};
 
+  static std::map<int, PtrPrimitiveRTree> edgeTrees;
+
+  static std::map<int, PtrPrimitiveRTree> triangleTrees;
+
+  static std::map<int, PtrPrimitiveRTree> quadTrees;
+};
 
-using Box3d = boost::geometry::model::box<boost::geometry::model::point<double, 3, boost::geometry::cs::cartesian>>;
 
 /// Returns a boost::geometry box that encloses a sphere of given radius around a middle point
 Box3d getEnclosingBox(Vertex const & middlePoint, double sphereRadius);
@@ -99,6 +99,9 @@ public:
   double getEnclosingRadius() const;
 
 private:
+  /// Allows the mesh to renumber its elements, see Mesh::retain().
+  friend class Mesh;
+
   /// Edges defining the triangle.
   std::array<Edge *, 3> _edges;
 
@@ -8,7 +8,7 @@ int Vertex:: getDimensions() const
   return _coords.size();
 }
 
-const Eigen::VectorXd& Vertex::getNormal () const
+const Vertex::RawCoords& Vertex::getNormal () const
 {
   return _normal;
 }
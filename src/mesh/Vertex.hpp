@@ -12,6 +12,15 @@ class Vertex : public PropertyContainer, private boost::noncopyable
 {
 public:
 
+  /**
+   * @brief Storage type of coordinates and normals.
+   *
+   * A dynamic vector with a compile-time upper bound of three entries. The
+   * entries are stored inside the Vertex object itself, hence creating a
+   * vertex does not allocate memory for its coordinates and normal on the heap.
+   */
+  using RawCoords = Eigen::Matrix<double, Eigen::Dynamic, 1, Eigen::ColMajor, 3, 1>;
+
   /// Constructor for vertex
   template<typename VECTOR_T>
   Vertex (
@@ -36,10 +45,10 @@ public:
   int getID() const;
 
   /// Returns the coordinates of the vertex.
-  const Eigen::VectorXd& getCoords() const;
+  const RawCoords& getCoords() const;
 
   /// Returns the normal of the vertex.
-  const Eigen::VectorXd& getNormal() const;
+  const RawCoords& getNormal() const;
 
   int getGlobalIndex() const;
 
@@ -54,15 +63,17 @@ public:
   void tag();
 
 private:
+  /// Allows the mesh to renumber its elements, see Mesh::retain().
+  friend class Mesh;
 
   /// Unique (among vertices in one mesh) ID of the vertex.
   int _id;
 
   /// Coordinates of the vertex.
-  Eigen::VectorXd _coords;
+  RawCoords _coords;
 
   /// Normal of the vertex.
-  Eigen::VectorXd _normal;
+  RawCoords _normal;
 
   /// global (unique) index for parallel simulations
   int _globalIndex = -1;
@@ -85,7 +96,7 @@ Vertex:: Vertex
   PropertyContainer (),
   _id ( id ),
   _coords ( coordinates ),
-  _normal ( Eigen::VectorXd::Constant(_coords.size(), 0.0) )
+  _normal ( RawCoords::Zero(_coords.size()) )
 {}
 
 template<typename VECTOR_T>
@@ -111,7 +122,7 @@ inline int Vertex:: getID() const
   return _id;
 }
 
-inline const Eigen::VectorXd& Vertex::getCoords() const
+inline const Vertex::RawCoords& Vertex::getCoords() const
 {
   return _coords;
 }
@@ -64,6 +64,32 @@ struct access<Eigen::VectorXd, Dimension>
   }
 };
 
+/// Adapts Vertex::RawCoords to boost.geometry
+/*
+ * This adapts the coordinate storage of a Vertex to a 3d point. For non-existing dimensions, zero is returned.
+ */
+template<> struct tag<Vertex::RawCoords>               { using type = point_tag; };
+template<> struct coordinate_type<Vertex::RawCoords>   { using type = double; };
+template<> struct coordinate_system<Vertex::RawCoords> { using type = cs::cartesian; };
+template<> struct dimension<Vertex::RawCoords> : boost::mpl::int_<3> {};
+
+template<size_t Dimension>
+struct access<Vertex::RawCoords, Dimension>
+{
+  static double get(Vertex::RawCoords const& p)
+  {
+    if (Dimension > static_cast<size_t>(p.rows())-1)
+      return 0;
+   
+    return p[Dimension];
+  }
+  
+  static void set(Vertex::RawCoords& p, double const& value)
+  {
+    p[Dimension] = value;
+  }
+};
+
 }}}
 
 namespace precice {
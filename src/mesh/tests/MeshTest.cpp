@@ -271,6 +271,66 @@ BOOST_AUTO_TEST_CASE(BoundingBoxCOG_3D)
 }
 
 
+BOOST_AUTO_TEST_CASE(FindEdge)
+{
+  Mesh mesh("MyMesh", 3, false);
+  Vertex& v0 = mesh.createVertex(Vector3d(0.0, 0.0, 0.0));
+  Vertex& v1 = mesh.createVertex(Vector3d(1.0, 0.0, 0.0));
+  Vertex& v2 = mesh.createVertex(Vector3d(0.0, 1.0, 0.0));
+  Edge& e0 = mesh.createEdge(v0, v1);
+  Edge& e1 = mesh.createEdge(v2, v1);
+
+  BOOST_TEST(mesh.findEdge(v0.getID(), v1.getID()) == &e0);
+  BOOST_TEST(mesh.findEdge(v1.getID(), v0.getID()) == &e0);
+  BOOST_TEST(mesh.findEdge(v1.getID(), v2.getID()) == &e1);
+  BOOST_TEST(mesh.findEdge(v0.getID(), v2.getID()) == nullptr);
+
+  mesh.clear();
+  BOOST_TEST(mesh.findEdge(0, 1) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Retain)
+{
+  Mesh mesh("MyMesh", 3, false);
+  Vertex& v0 = mesh.createVertex(Vector3d(0.0, 0.0, 0.0));
+  Vertex& v1 = mesh.createVertex(Vector3d(1.0, 0.0, 0.0));
+  Vertex& v2 = mesh.createVertex(Vector3d(0.0, 1.0, 0.0));
+  Vertex& v3 = mesh.createVertex(Vector3d(1.0, 1.0, 0.0));
+  Edge& e0 = mesh.createEdge(v0, v1);
+  Edge& e1 = mesh.createEdge(v1, v2);
+  Edge& e2 = mesh.createEdge(v2, v0);
+  Edge& e3 = mesh.createEdge(v1, v3);
+  Edge& e4 = mesh.createEdge(v3, v2);
+  mesh.createTriangle(e0, e1, e2);
+  Triangle& t1 = mesh.createTriangle(e1, e3, e4);
+
+  int changes = 0;
+  mesh.meshChanged.connect([&changes](Mesh &) { changes++; });
+
+  // removes v0, together with e0, e2 and the first triangle
+  mesh.retain([](const Vertex &vertex) { return vertex.getCoords()[0] + vertex.getCoords()[1] > 0.5; });
+  BOOST_TEST(changes == 1);
+
+  BOOST_TEST(mesh.vertices().size() == 3);
+  BOOST_TEST(mesh.edges().size() == 3);
+  BOOST_TEST(mesh.triangles().size() == 1);
+  BOOST_TEST(&mesh.vertices()[0] == &v1);
+  BOOST_TEST(&mesh.edges()[0] == &e1);
+  BOOST_TEST(&mesh.triangles()[0] == &t1);
+  for (int i = 0; i < 3; i++) {
+    BOOST_TEST(mesh.vertices()[i].getID() == i);
+    BOOST_TEST(mesh.edges()[i].getID() == i);
+  }
+  BOOST_TEST(t1.getID() == 0);
+
+  BOOST_TEST(mesh.findEdge(v1.getID(), v2.getID()) == &e1);
+  BOOST_TEST(mesh.findEdge(v3.getID(), v1.getID()) == &e3);
+  BOOST_TEST(mesh.findEdge(v2.getID(), v3.getID()) == &e4);
+
+  BOOST_TEST(mesh.createVertex(Vector3d(2.0, 2.0, 0.0)).getID() == 3);
+  BOOST_TEST(mesh.createEdge(v1, v1).getID() == 3);
+}
+
 BOOST_AUTO_TEST_CASE(Demonstration)
 {
   for ( int dim=2; dim <= 3; dim++ ){
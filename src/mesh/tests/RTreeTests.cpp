@@ -1,4 +1,6 @@
 #include "testing/Testing.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Triangle.hpp"
 #include "mesh/RTree.hpp"
 #include "mesh/impl/RTreeAdapter.hpp"
 
@@ -119,6 +121,73 @@ BOOST_AUTO_TEST_CASE(QueryWithBox)
   }
 }
 
+BOOST_AUTO_TEST_CASE(QueryPrimitives_3D)
+{
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 3, false));
+  auto & v0 = mesh->createVertex(Eigen::Vector3d(0, 0, 0));
+  auto & v1 = mesh->createVertex(Eigen::Vector3d(1, 0, 0));
+  auto & v2 = mesh->createVertex(Eigen::Vector3d(0, 1, 0));
+  auto & v3 = mesh->createVertex(Eigen::Vector3d(5, 5, 5));
+  auto & v4 = mesh->createVertex(Eigen::Vector3d(6, 5, 5));
+  auto & v5 = mesh->createVertex(Eigen::Vector3d(5, 6, 5));
+  auto & e0 = mesh->createEdge(v0, v1);
+  auto & e1 = mesh->createEdge(v1, v2);
+  auto & e2 = mesh->createEdge(v2, v0);
+  auto & e3 = mesh->createEdge(v3, v4);
+  auto & e4 = mesh->createEdge(v4, v5);
+  auto & e5 = mesh->createEdge(v5, v3);
+  mesh->createTriangle(e0, e1, e2);
+  mesh->createTriangle(e3, e4, e5);
+
+  auto edgeTree = rtree::getEdgeRTree(mesh);
+  auto triangleTree = rtree::getTriangleRTree(mesh);
+  auto quadTree = rtree::getQuadRTree(mesh);
+  BOOST_TEST(edgeTree->size() == 6);
+  BOOST_TEST(triangleTree->size() == 2);
+  BOOST_TEST(quadTree->size() == 0);
+
+  Eigen::VectorXd searchVector(Eigen::Vector3d(5.2, 5.2, 5.5));
+  {
+    std::vector<rtree::PrimitiveBox> results;
+    triangleTree->query(bgi::nearest(searchVector, 1), std::back_inserter(results));
+    BOOST_TEST(results.size() == 1);
+    BOOST_TEST(results[0].second == 1);
+  }
+  {
+    std::vector<rtree::PrimitiveBox> results;
+    edgeTree->query(bgi::nearest(searchVector, 3), std::back_inserter(results));
+    BOOST_TEST(results.size() == 3);
+    for (auto & result : results) {
+      BOOST_TEST(result.second >= 3);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PrimitiveCacheRebuild)
+{
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 3, false));
+  auto & v0 = mesh->createVertex(Eigen::Vector3d(0, 0, 0));
+  auto & v1 = mesh->createVertex(Eigen::Vector3d(1, 0, 0));
+  auto & v2 = mesh->createVertex(Eigen::Vector3d(0, 1, 0));
+  auto & e0 = mesh->createEdge(v0, v1);
+
+  auto edgeTree1 = rtree::getEdgeRTree(mesh);
+  auto triangleTree1 = rtree::getTriangleRTree(mesh);
+  BOOST_TEST(edgeTree1->size() == 1);
+  BOOST_TEST(triangleTree1->size() == 0);
+  BOOST_TEST(rtree::getEdgeRTree(mesh) == edgeTree1);
+
+  // Elements are added without a meshChanged signal
+  auto & e1 = mesh->createEdge(v1, v2);
+  auto & e2 = mesh->createEdge(v2, v0);
+  mesh->createTriangle(e0, e1, e2);
+
+  auto edgeTree2 = rtree::getEdgeRTree(mesh);
+  auto triangleTree2 = rtree::getTriangleRTree(mesh);
+  BOOST_TEST(edgeTree2 != edgeTree1);
+  BOOST_TEST(edgeTree2->size() == 3);
+  BOOST_TEST(triangleTree2->size() == 1);
+}
 
 BOOST_AUTO_TEST_CASE(VertexAdapter)
 {
@@ -147,9 +216,12 @@ BOOST_AUTO_TEST_CASE(CacheClearing)
   mesh->createVertex(Eigen::Vector2d(0, 0));
   
   auto tree1 = rtree::getVertexRTree(mesh);
+  auto edgeTree1 = rtree::getEdgeRTree(mesh);
   BOOST_TEST(rtree::trees.size() == 1);
+  BOOST_TEST(rtree::edgeTrees.size() == 1);
   mesh->meshChanged(*mesh); // Emit signal, that mesh has changed
   BOOST_TEST(rtree::trees.size() == 0);
+  BOOST_TEST(rtree::edgeTrees.size() == 0);
   
   auto tree2 = rtree::getVertexRTree(mesh);
   BOOST_TEST(rtree::trees.size() == 1);
@@ -5,11 +5,14 @@
 #include "mapping/Mapping.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/RTree.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/EventTimings.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/MasterSlave.hpp"
+#include <algorithm>
+#include <unordered_map>
 
 using precice::utils::Event;
 
@@ -100,22 +103,27 @@ void ReceivedPartition::compute()
       assertion(utils::MasterSlave::_rank == 0);
       assertion(utils::MasterSlave::_size > 1);
 
+      // Gather the bounding boxes of all slaves first, such that the global mesh
+      // is only traversed once instead of once per slave.
+      std::vector<mesh::Mesh::BoundingBox> slaveBBs(utils::MasterSlave::_size - 1, _bb);
       for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
-        com::CommunicateMesh(utils::MasterSlave::_communication).receiveBoundingBox(_bb, rankSlave);
+        mesh::Mesh::BoundingBox &bb = slaveBBs[rankSlave - 1];
+        com::CommunicateMesh(utils::MasterSlave::_communication).receiveBoundingBox(bb, rankSlave);
 
-        DEBUG("From slave " << rankSlave << ", bounding mesh: " << _bb[0].first
-              << ", " << _bb[0].second << " and " << _bb[1].first << ", " << _bb[1].second);
-        mesh::Mesh slaveMesh("SlaveMesh", _dimensions, _mesh->isFlipNormals());
-        filterMesh(slaveMesh, true);
-        com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh(slaveMesh, rankSlave);
+        DEBUG("From slave " << rankSlave << ", bounding mesh: " << bb[0].first
+              << ", " << bb[0].second << " and " << bb[1].first << ", " << bb[1].second);
       }
 
+      std::vector<mesh::PtrMesh> slaveMeshes;
+      filterMeshByBoundingBoxes(slaveBBs, slaveMeshes);
+      for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
+        com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh(*slaveMeshes[rankSlave - 1], rankSlave);
+      }
+      slaveMeshes.clear();
+
       // Now also filter the remaining master mesh
       prepareBoundingBox();
-      mesh::Mesh filteredMesh("FilteredMesh", _dimensions, _mesh->isFlipNormals());
-      filterMesh(filteredMesh, true);
-      _mesh->clear();
-      _mesh->addMesh(filteredMesh);
+      _mesh->retain([this](const mesh::Vertex &vertex) { return isVertexInBB(vertex); });
       _mesh->computeState();
       DEBUG("Master mesh after filtering, #vertices " << _mesh->vertices().size());
 
@@ -151,8 +159,8 @@ void ReceivedPartition::compute()
       Event e2("filter mesh by bounding box");
 
       prepareBoundingBox();
-      mesh::Mesh filteredMesh("FilteredMesh", _dimensions, _mesh->isFlipNormals());
-      filterMesh(filteredMesh, true);
+      int unfilteredVertexCount = _mesh->vertices().size();
+      _mesh->retain([this](const mesh::Vertex &vertex) { return isVertexInBB(vertex); });
 
       if ((_fromMapping.use_count() > 0 && _fromMapping->getOutputMesh()->vertices().size() > 0) ||
           (_toMapping.use_count() > 0 && _toMapping->getInputMesh()->vertices().size() > 0)) {
@@ -163,12 +171,10 @@ void ReceivedPartition::compute()
           "Please check your geometry setup again. Small overlaps or gaps are no problem. "
           "If your geometry setup is correct and if you have very different mesh resolutions on both sides, increasing the safety-factor "
           "of the decomposition strategy might be necessary.";
-        CHECK(filteredMesh.vertices().size() > 0, msg);
+        CHECK(_mesh->vertices().size() > 0, msg);
       }
 
-      DEBUG("Bounding box filter, filtered from " << _mesh->vertices().size() << " vertices to " << filteredMesh.vertices().size() << " vertices.");
-      _mesh->clear();
-      _mesh->addMesh(filteredMesh);
+      DEBUG("Bounding box filter, filtered from " << unfilteredVertexCount << " vertices to " << _mesh->vertices().size() << " vertices.");
       _mesh->computeState();
       e2.stop();
     } else {
@@ -197,12 +203,10 @@ void ReceivedPartition::compute()
 
   // (5) Filter mesh according to tag
   INFO("Filter mesh " << _mesh->getName() << " by mappings");
-  Event      e5("filter mesh by mappings");
-  mesh::Mesh filteredMesh("FilteredMesh", _dimensions, _mesh->isFlipNormals());
-  filterMesh(filteredMesh, false);
-  DEBUG("Mapping filter, filtered from " << _mesh->vertices().size() << " vertices to " << filteredMesh.vertices().size() << " vertices.");
-  _mesh->clear();
-  _mesh->addMesh(filteredMesh);
+  Event e5("filter mesh by mappings");
+  int   unfilteredVertexCount = _mesh->vertices().size();
+  _mesh->retain([](const mesh::Vertex &vertex) { return vertex.isTagged(); });
+  DEBUG("Mapping filter, filtered from " << unfilteredVertexCount << " vertices to " << _mesh->vertices().size() << " vertices.");
   _mesh->computeState();
   e5.stop();
 
@@ -247,61 +251,110 @@ void ReceivedPartition::compute()
   computeVertexOffsets();
 }
 
-void ReceivedPartition::filterMesh(mesh::Mesh &filteredMesh, const bool filterByBB)
+void ReceivedPartition::filterMeshByBoundingBoxes(
+    const std::vector<mesh::Mesh::BoundingBox> &bbs,
+    std::vector<mesh::PtrMesh> &                filteredMeshes)
 {
-  TRACE(filterByBB);
+  TRACE(bbs.size());
 
-  DEBUG("Bounding mesh. #vertices: " << _mesh->vertices().size()
-        << ", #edges: " << _mesh->edges().size()
-        << ", #triangles: " << _mesh->triangles().size()
-        << ", rank: " << utils::MasterSlave::_rank);
+  int ranks = bbs.size();
+  filteredMeshes.clear();
+  for (int rank = 0; rank < ranks; rank++) {
+    filteredMeshes.push_back(std::make_shared<mesh::Mesh>("SlaveMesh", _dimensions, _mesh->isFlipNormals()));
+  }
 
-  std::map<int, mesh::Vertex *> vertexMap;
-  std::map<int, mesh::Edge *>   edgeMap;
-  int                           vertexCounter = 0;
+  // copies of a vertex or edge in the filtered meshes, i.e., pairs of (rank, copy), ordered by rank
+  std::unordered_map<int, std::vector<std::pair<int, mesh::Vertex *>>> vertexCopies;
+  std::unordered_map<int, std::vector<std::pair<int, mesh::Edge *>>>   edgeCopies;
+  vertexCopies.reserve(_mesh->vertices().size());
+  edgeCopies.reserve(_mesh->edges().size());
+
+  // Tree of the bounding boxes of all ranks, such that each vertex is only tested against the boxes containing it
+  namespace bg  = boost::geometry;
+  namespace bgi = boost::geometry::index;
+  std::vector<mesh::rtree::PrimitiveBox> boxes;
+  for (int rank = 0; rank < ranks; rank++) {
+    Eigen::Vector3d lower = Eigen::Vector3d::Zero();
+    Eigen::Vector3d upper = Eigen::Vector3d::Zero();
+    for (int d = 0; d < _dimensions; d++) {
+      lower[d] = bbs[rank][d].first;
+      upper[d] = bbs[rank][d].second;
+    }
+    // Boxes of ranks without vertices are empty and contain no vertex
+    if ((lower.array() > upper.array()).any())
+      continue;
+    mesh::Box3d box;
+    bg::set<bg::min_corner, 0>(box, lower[0]);
+    bg::set<bg::min_corner, 1>(box, lower[1]);
+    bg::set<bg::min_corner, 2>(box, lower[2]);
+    bg::set<bg::max_corner, 0>(box, upper[0]);
+    bg::set<bg::max_corner, 1>(box, upper[1]);
+    bg::set<bg::max_corner, 2>(box, upper[2]);
+    boxes.emplace_back(box, rank);
+  }
+  mesh::rtree::PrimitiveRTree bbTree(boxes);
 
+  std::vector<mesh::rtree::PrimitiveBox> hits;
   for (const mesh::Vertex &vertex : _mesh->vertices()) {
-
-    if ((filterByBB && isVertexInBB(vertex)) || (not filterByBB && vertex.isTagged())) {
-      mesh::Vertex &v = filteredMesh.createVertex(vertex.getCoords());
+    hits.clear();
+    bbTree.query(bgi::intersects(vertex.getCoords()), std::back_inserter(hits));
+    // copies are ordered by rank
+    std::sort(hits.begin(), hits.end(), [](const mesh::rtree::PrimitiveBox &a, const mesh::rtree::PrimitiveBox &b) {
+      return a.second < b.second;
+    });
+    for (const auto &hit : hits) {
+      int rank = hit.second;
+      assertion(isVertexInBB(vertex, bbs[rank]), rank);
+      mesh::Vertex &v = filteredMeshes[rank]->createVertex(vertex.getCoords());
       v.setGlobalIndex(vertex.getGlobalIndex());
       if (vertex.isTagged())
         v.tag();
       v.setOwner(vertex.isOwner());
-      vertexMap[vertex.getID()] = &v;
+      vertexCopies[vertex.getID()].emplace_back(rank, &v);
     }
-    vertexCounter++;
   }
 
-  // Add all edges formed by the contributing vertices
+  // Add all edges formed by the contributing vertices, to every rank that holds both vertices
   for (mesh::Edge &edge : _mesh->edges()) {
-    int vertexIndex1 = edge.vertex(0).getID();
-    int vertexIndex2 = edge.vertex(1).getID();
-    if (utils::contained(vertexIndex1, vertexMap) &&
-        utils::contained(vertexIndex2, vertexMap)) {
-      mesh::Edge &e         = filteredMesh.createEdge(*vertexMap[vertexIndex1], *vertexMap[vertexIndex2]);
-      edgeMap[edge.getID()] = &e;
+    auto copies1 = vertexCopies.find(edge.vertex(0).getID());
+    auto copies2 = vertexCopies.find(edge.vertex(1).getID());
+    if (copies1 == vertexCopies.end() || copies2 == vertexCopies.end())
+      continue;
+    for (const auto &copy1 : copies1->second) {
+      for (const auto &copy2 : copies2->second) {
+        if (copy1.first == copy2.first) {
+          mesh::Edge &e = filteredMeshes[copy1.first]->createEdge(*copy1.second, *copy2.second);
+          edgeCopies[edge.getID()].emplace_back(copy1.first, &e);
+        }
+      }
     }
   }
 
   // Add all triangles formed by the contributing edges
   if (_dimensions == 3) {
     for (mesh::Triangle &triangle : _mesh->triangles()) {
-      int edgeIndex1 = triangle.edge(0).getID();
-      int edgeIndex2 = triangle.edge(1).getID();
-      int edgeIndex3 = triangle.edge(2).getID();
-      if (utils::contained(edgeIndex1, edgeMap) &&
-          utils::contained(edgeIndex2, edgeMap) &&
-          utils::contained(edgeIndex3, edgeMap)) {
-        filteredMesh.createTriangle(*edgeMap[edgeIndex1], *edgeMap[edgeIndex2], *edgeMap[edgeIndex3]);
+      auto copies1 = edgeCopies.find(triangle.edge(0).getID());
+      auto copies2 = edgeCopies.find(triangle.edge(1).getID());
+      auto copies3 = edgeCopies.find(triangle.edge(2).getID());
+      if (copies1 == edgeCopies.end() || copies2 == edgeCopies.end() || copies3 == edgeCopies.end())
+        continue;
+      for (const auto &copy1 : copies1->second) {
+        for (const auto &copy2 : copies2->second) {
+          if (copy1.first != copy2.first)
+            continue;
+          for (const auto &copy3 : copies3->second) {
+            if (copy1.first == copy3.first) {
+              filteredMeshes[copy1.first]->createTriangle(*copy1.second, *copy2.second, *copy3.second);
+            }
+          }
+        }
       }
     }
   }
 
-  DEBUG("Filtered mesh. #vertices: " << filteredMesh.vertices().size()
-        << ", #edges: " << filteredMesh.edges().size()
-        << ", #triangles: " << filteredMesh.triangles().size()
-        << ", rank: " << utils::MasterSlave::_rank);
+  DEBUG("Filtered global mesh for " << ranks << " ranks. #vertices: " << _mesh->vertices().size()
+        << ", #edges: " << _mesh->edges().size()
+        << ", #triangles: " << _mesh->triangles().size());
 }
 
 void ReceivedPartition::prepareBoundingBox()
@@ -343,9 +396,14 @@ void ReceivedPartition::prepareBoundingBox()
 }
 
 bool ReceivedPartition::isVertexInBB(const mesh::Vertex &vertex)
+{
+  return isVertexInBB(vertex, _bb);
+}
+
+bool ReceivedPartition::isVertexInBB(const mesh::Vertex &vertex, const mesh::Mesh::BoundingBox &bb)
 {
   for (int d = 0; d < _dimensions; d++) {
-    if (vertex.getCoords()[d] < _bb[d].first or vertex.getCoords()[d] > _bb[d].second) {
+    if (vertex.getCoords()[d] < bb[d].first or vertex.getCoords()[d] > bb[d].second) {
       return false;
     }
   }
@@ -357,123 +415,93 @@ void ReceivedPartition::createOwnerInformation()
   TRACE();
 
   if (utils::MasterSlave::_slaveMode) {
-    int numberOfVertices = _mesh->vertices().size();
-    utils::MasterSlave::_communication->send(numberOfVertices, 0);
-
-    if (numberOfVertices != 0) {
-      std::vector<int> tags(numberOfVertices, -1);
-      std::vector<int> globalIDs(numberOfVertices, -1);
-      bool             atInterface = false;
-      for (int i = 0; i < numberOfVertices; i++) {
-        globalIDs[i] = _mesh->vertices()[i].getGlobalIndex();
-        if (_mesh->vertices()[i].isTagged()) {
-          tags[i]     = 1;
-          atInterface = true;
-        } else {
-          tags[i] = 0;
-        }
-      }
-      DEBUG("My tags: " << tags);
-      DEBUG("My global IDs: " << globalIDs);
-      utils::MasterSlave::_communication->send(tags, 0);
-      utils::MasterSlave::_communication->send(globalIDs, 0);
-      utils::MasterSlave::_communication->send(atInterface, 0);
+    // Only vertices tagged in the first round can become owned, so only they take part
+    std::vector<int> taggedGlobalIDs;
+    for (const mesh::Vertex &vertex : _mesh->vertices()) {
+      if (vertex.isTagged())
+        taggedGlobalIDs.push_back(vertex.getGlobalIndex());
+    }
+    int numberOfTaggedVertices = taggedGlobalIDs.size();
+    utils::MasterSlave::_communication->send(numberOfTaggedVertices, 0);
 
-      std::vector<int> ownerVec(numberOfVertices, -1);
+    std::vector<int> ownerVec(numberOfTaggedVertices, -1);
+    if (numberOfTaggedVertices != 0) {
+      DEBUG("My tagged global IDs: " << taggedGlobalIDs);
+      utils::MasterSlave::_communication->send(taggedGlobalIDs, 0);
       utils::MasterSlave::_communication->receive(ownerVec, 0);
-      DEBUG("My owner information: " << ownerVec);
-      setOwnerInformation(ownerVec);
     }
+    DEBUG("My owner information: " << ownerVec);
+    setOwnerInformation(ownerVec);
   }
 
   else if (utils::MasterSlave::_masterMode) {
-    // To temporary store which vertices already have an owner
-    std::vector<int> globalOwnerVec(_mesh->getGlobalNumberOfVertices(), 0);
-    // The same per rank
-    std::vector<std::vector<int>> slaveOwnerVecs(utils::MasterSlave::_size);
-    // Global IDs per rank
-    std::vector<std::vector<int>> slaveGlobalIDs(utils::MasterSlave::_size);
-    // Tag information per rank
-    std::vector<std::vector<int>> slaveTags(utils::MasterSlave::_size);
-
-    // Fill master data
-    bool masterAtInterface = false;
-    slaveOwnerVecs[0].resize(_mesh->vertices().size());
-    slaveGlobalIDs[0].resize(_mesh->vertices().size());
-    slaveTags[0].resize(_mesh->vertices().size());
-    for (size_t i = 0; i < _mesh->vertices().size(); i++) {
-      slaveGlobalIDs[0][i] = _mesh->vertices()[i].getGlobalIndex();
-      if (_mesh->vertices()[i].isTagged()) {
-        masterAtInterface = true;
-        slaveTags[0][i]   = 1;
-      } else {
-        slaveTags[0][i] = 0;
-      }
+    // Global IDs of the tagged vertices per rank
+    std::vector<std::vector<int>> taggedGlobalIDs(utils::MasterSlave::_size);
+    for (const mesh::Vertex &vertex : _mesh->vertices()) {
+      if (vertex.isTagged())
+        taggedGlobalIDs[0].push_back(vertex.getGlobalIndex());
     }
-    DEBUG("My tags: " << slaveTags[0]);
-
-    // receive slave data
-    int ranksAtInterface = 0;
-    if (masterAtInterface)
-      ranksAtInterface++;
+    DEBUG("My tagged global IDs: " << taggedGlobalIDs[0]);
 
     for (int rank = 1; rank < utils::MasterSlave::_size; rank++) {
-      int localNumberOfVertices = -1;
-      utils::MasterSlave::_communication->receive(localNumberOfVertices, rank);
-      DEBUG("Rank " << rank << " has " << localNumberOfVertices << " vertices.");
-      slaveOwnerVecs[rank].resize(localNumberOfVertices, 0);
-
-      if (localNumberOfVertices != 0) {
-        utils::MasterSlave::_communication->receive(slaveTags[rank], rank);
-        utils::MasterSlave::_communication->receive(slaveGlobalIDs[rank], rank);
-        DEBUG("Rank " << rank << " has this tags " << slaveTags[rank]);
-        DEBUG("Rank " << rank << " has this global IDs " << slaveGlobalIDs[rank]);
-        bool atInterface = false;
-        utils::MasterSlave::_communication->receive(atInterface, rank);
-        if (atInterface)
-          ranksAtInterface++;
+      int numberOfTaggedVertices = -1;
+      utils::MasterSlave::_communication->receive(numberOfTaggedVertices, rank);
+      DEBUG("Rank " << rank << " has " << numberOfTaggedVertices << " tagged vertices.");
+      if (numberOfTaggedVertices != 0) {
+        utils::MasterSlave::_communication->receive(taggedGlobalIDs[rank], rank);
+        DEBUG("Rank " << rank << " has this tagged global IDs " << taggedGlobalIDs[rank]);
       }
     }
 
-    // Decide upon owners,
-    int localGuess = _mesh->getGlobalNumberOfVertices() / ranksAtInterface; // Guess for a decent load balancing
-    // First round: every slave gets localGuess vertices
+    // Ranks that could own a vertex, in ascending order. Once decided, only the owner is left.
+    // Only vertices at the interface of some rank are stored, not the whole global mesh.
+    std::unordered_map<int, std::vector<int>> candidateRanks;
     for (int rank = 0; rank < utils::MasterSlave::_size; rank++) {
-      int counter = 0;
-      for (size_t i = 0; i < slaveOwnerVecs[rank].size(); i++) {
-         // Vertex has no owner yet and rank could be owner
-        if (globalOwnerVec[slaveGlobalIDs[rank][i]] == 0 && slaveTags[rank][i] == 1) {
-          slaveOwnerVecs[rank][i]                 = 1; // Now rank is owner
-          globalOwnerVec[slaveGlobalIDs[rank][i]] = 1; // Vertex now has owner
-          counter++;
-          if (counter == localGuess)
-            break;
-        }
+      for (int globalID : taggedGlobalIDs[rank]) {
+        candidateRanks[globalID].push_back(rank);
       }
     }
 
-    // Second round: distribute all other vertices in a greedy way
+    // Decide upon owners: vertices with a single candidate are fixed, every shared vertex then
+    // goes to the candidate that owns the fewest vertices so far (the lowest rank on a tie).
+    std::vector<int> ownedVertices(utils::MasterSlave::_size, 0);
+    for (const auto &candidates : candidateRanks) {
+      if (candidates.second.size() == 1)
+        ownedVertices[candidates.second.front()]++;
+    }
     for (int rank = 0; rank < utils::MasterSlave::_size; rank++) {
-      for (size_t i = 0; i < slaveOwnerVecs[rank].size(); i++) {
-        if (globalOwnerVec[slaveGlobalIDs[rank][i]] == 0 && slaveTags[rank][i] == 1) {
-          slaveOwnerVecs[rank][i]                 = 1;
-          globalOwnerVec[slaveGlobalIDs[rank][i]] = rank + 1;
+      for (int globalID : taggedGlobalIDs[rank]) {
+        std::vector<int> &candidates = candidateRanks[globalID];
+        if (candidates.size() > 1) {
+          int owner = *std::min_element(candidates.begin(), candidates.end(),
+                                        [&ownedVertices](int lhs, int rhs) {
+                                          return ownedVertices[lhs] < ownedVertices[rhs];
+                                        });
+          candidates.assign(1, owner);
+          ownedVertices[owner]++;
         }
       }
     }
+    DEBUG("Number of owned vertices per rank: " << ownedVertices);
 
     // Send information back to slaves
-    for (int rank = 1; rank < utils::MasterSlave::_size; rank++) {
-      if (not slaveTags[rank].empty())
-        utils::MasterSlave::_communication->send(slaveOwnerVecs[rank], rank);
+    for (int rank = 0; rank < utils::MasterSlave::_size; rank++) {
+      std::vector<int> ownerVec(taggedGlobalIDs[rank].size(), 0);
+      for (size_t i = 0; i < ownerVec.size(); i++) {
+        if (candidateRanks[taggedGlobalIDs[rank][i]].front() == rank)
+          ownerVec[i] = 1;
+      }
+      if (rank == 0) {
+        DEBUG("My owner information: " << ownerVec);
+        setOwnerInformation(ownerVec);
+      } else if (not ownerVec.empty()) {
+        utils::MasterSlave::_communication->send(ownerVec, rank);
+      }
     }
-    // Master data
-    DEBUG("My owner information: " << slaveOwnerVecs[0]);
-    setOwnerInformation(slaveOwnerVecs[0]);
 
 #ifndef NDEBUG
-    for (size_t i = 0; i < globalOwnerVec.size(); i++) {
-      if (globalOwnerVec[i] == 0) {
+    for (int i = 0; i < _mesh->getGlobalNumberOfVertices(); i++) {
+      if (candidateRanks.count(i) == 0) {
         WARN("The Vertex with global index " << i << " of mesh: " << _mesh->getName()
              << " was completely filtered out, since it has no influence on any mapping.");
       }
@@ -486,11 +514,16 @@ void ReceivedPartition::setOwnerInformation(const std::vector<int> &ownerVec)
 {
   size_t i = 0;
   for (mesh::Vertex &vertex : _mesh->vertices()) {
-    assertion(i < ownerVec.size());
-    assertion(ownerVec[i] != -1);
-    vertex.setOwner(ownerVec[i] == 1);
-    i++;
+    if (vertex.isTagged()) {
+      assertion(i < ownerVec.size());
+      assertion(ownerVec[i] != -1);
+      vertex.setOwner(ownerVec[i] == 1);
+      i++;
+    } else {
+      vertex.setOwner(false);
+    }
   }
+  assertion(i == ownerVec.size());
 }
 
 } // namespace partition
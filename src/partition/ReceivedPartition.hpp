@@ -4,6 +4,7 @@
 #include "Partition.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
 #include "mesh/Vertex.hpp"
 
 namespace precice
@@ -42,23 +43,27 @@ public:
   virtual void compute() override;
 
 private:
-  /// Create filteredMesh from the filtered _mesh.
+  /// Filters _mesh by multiple bounding boxes in one pass over the mesh.
   /*
-   * Copies all vertices/edges/triangles that are either contained in the bounding box
-   * or tagged to the filteredMesh. Edges and triangles are copied, when ALL vertices
-   * are part of the filteredMesh i.e. their IDs are contained in vertexMap.
+   * filteredMeshes[i] contains all vertices of _mesh that are contained in bbs[i] and all
+   * edges/triangles whose vertices resp. edges are all part of it.
    */
-  void filterMesh(mesh::Mesh &filteredMesh, const bool filterByBB);
-  
+  void filterMeshByBoundingBoxes(
+      const std::vector<mesh::Mesh::BoundingBox> &bbs,
+      std::vector<mesh::PtrMesh> &                filteredMeshes);
+
   /// Sets _bb to the union with the mesh from fromMapping resp. toMapping, also enlage by _safetyFactor
   void prepareBoundingBox();
 
   /// Checks if vertex in contained in _bb
   bool isVertexInBB(const mesh::Vertex &vertex);
 
+  /// Checks if vertex in contained in bb
+  bool isVertexInBB(const mesh::Vertex &vertex, const mesh::Mesh::BoundingBox &bb);
+
   virtual void createOwnerInformation() override;
 
-  /// Helper function for 'createOwnerFunction' to set local owner information
+  /// Helper function for 'createOwnerFunction' to set local owner information, one entry per tagged vertex
   void setOwnerInformation(const std::vector<int> &ownerVec);
 
   GeometricFilter _geometricFilter;
@@ -388,6 +388,73 @@ BOOST_AUTO_TEST_CASE(RePartitionNPPreFilterPostFilter2D, *testing::OnSize(4))
   tearDownParallelEnvironment();
 }
 
+BOOST_AUTO_TEST_CASE(RePartitionBalancedOwnership2D, *testing::OnSize(4))
+{
+  com::PtrCommunication participantCom =
+      com::PtrCommunication(new com::MPIDirectCommunication());
+  m2n::DistributedComFactory::SharedPointer distrFactory = m2n::DistributedComFactory::SharedPointer(
+      new m2n::GatherScatterComFactory(participantCom));
+  m2n::PtrM2N m2n = m2n::PtrM2N(new m2n::M2N(participantCom, distrFactory));
+
+  setupParallelEnvironment(m2n);
+
+  int  dimensions  = 2;
+  bool flipNormals = false;
+
+  if (utils::Parallel::getProcessRank() == 0) { //SOLIDZ
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, flipNormals));
+    for (int i = 0; i < 6; i++) {
+      pSolidzMesh->createVertex(Eigen::Vector2d(0.0, i)).setGlobalIndex(i);
+    }
+    bool              hasToSend = true;
+    ProvidedPartition part(pSolidzMesh, hasToSend);
+    part.setM2N(m2n);
+    part.communicate();
+  } else {
+    mesh::PtrMesh pNastinMesh(new mesh::Mesh("NastinMesh", dimensions, flipNormals));
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, flipNormals));
+
+    mapping::PtrMapping boundingFromMapping = mapping::PtrMapping(
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions));
+    boundingFromMapping->setMeshes(pSolidzMesh, pNastinMesh);
+
+    // Master needs solid vertices 0 to 3, Slave1 2 to 4 and Slave2 3 to 5. Vertex 3 is shared
+    // by all ranks, vertices 2 and 4 by two of them.
+    int first = utils::MasterSlave::_rank == 0 ? 0 : utils::MasterSlave::_rank + 1;
+    int last  = utils::MasterSlave::_rank == 0 ? 3 : utils::MasterSlave::_rank + 3;
+    for (int i = first; i <= last; i++) {
+      pNastinMesh->createVertex(Eigen::Vector2d(0.1, i));
+    }
+    pNastinMesh->computeState();
+
+    double            safetyFactor = 0.1;
+    ReceivedPartition part(pSolidzMesh, ReceivedPartition::NO_FILTER, safetyFactor);
+    part.setM2N(m2n);
+    part.setFromMapping(boundingFromMapping);
+    part.communicate();
+    part.compute();
+
+    // Master first owns 0 and 1, Slave2 owns 5. Shared vertices go to the rank owning fewest:
+    // 2 and 3 to Slave1, 4 to Slave2. Together, every vertex has exactly one owner.
+    std::vector<int> ownedGlobalIDs;
+    for (const mesh::Vertex &vertex : pSolidzMesh->vertices()) {
+      if (vertex.isOwner())
+        ownedGlobalIDs.push_back(vertex.getGlobalIndex());
+    }
+    if (utils::Parallel::getProcessRank() == 1) { //Master
+      BOOST_TEST(pSolidzMesh->vertices().size() == 4);
+      BOOST_TEST(ownedGlobalIDs == std::vector<int>({0, 1}));
+    } else if (utils::Parallel::getProcessRank() == 2) { //Slave1
+      BOOST_TEST(pSolidzMesh->vertices().size() == 3);
+      BOOST_TEST(ownedGlobalIDs == std::vector<int>({2, 3}));
+    } else if (utils::Parallel::getProcessRank() == 3) { //Slave2
+      BOOST_TEST(pSolidzMesh->vertices().size() == 3);
+      BOOST_TEST(ownedGlobalIDs == std::vector<int>({4, 5}));
+    }
+  }
+  tearDownParallelEnvironment();
+}
+
 #ifndef PRECICE_NO_PETSC
 BOOST_AUTO_TEST_CASE(RePartitionRBFGlobal2D,
                      *testing::OnSize(4) * boost::unit_test::fixture<testing::MasterComFixture>() * testing::Deleted())
@@ -437,10 +504,10 @@ BOOST_AUTO_TEST_CASE(RePartitionRBFGlobal2D,
     BOOST_TEST(pMesh->vertices().size() == 6);
     BOOST_TEST(pMesh->edges().size() == 5);
     BOOST_TEST(pMesh->vertices()[0].isOwner() == true);
-    BOOST_TEST(pMesh->vertices()[1].isOwner() == true);
+    BOOST_TEST(pMesh->vertices()[1].isOwner() == false);
     BOOST_TEST(pMesh->vertices()[2].isOwner() == true);
     BOOST_TEST(pMesh->vertices()[3].isOwner() == false);
-    BOOST_TEST(pMesh->vertices()[4].isOwner() == false);
+    BOOST_TEST(pMesh->vertices()[4].isOwner() == true);
     BOOST_TEST(pMesh->vertices()[5].isOwner() == false);
     BOOST_TEST(pMesh->vertices()[0].getGlobalIndex() == 0);
     BOOST_TEST(pMesh->vertices()[1].getGlobalIndex() == 1);
@@ -455,10 +522,10 @@ BOOST_AUTO_TEST_CASE(RePartitionRBFGlobal2D,
     BOOST_TEST(pMesh->vertices().size() == 6);
     BOOST_TEST(pMesh->edges().size() == 5);
     BOOST_TEST(pMesh->vertices()[0].isOwner() == false);
-    BOOST_TEST(pMesh->vertices()[1].isOwner() == false);
+    BOOST_TEST(pMesh->vertices()[1].isOwner() == true);
     BOOST_TEST(pMesh->vertices()[2].isOwner() == false);
     BOOST_TEST(pMesh->vertices()[3].isOwner() == true);
-    BOOST_TEST(pMesh->vertices()[4].isOwner() == true);
+    BOOST_TEST(pMesh->vertices()[4].isOwner() == false);
     BOOST_TEST(pMesh->vertices()[5].isOwner() == true);
     BOOST_TEST(pMesh->vertices()[0].getGlobalIndex() == 0);
     BOOST_TEST(pMesh->vertices()[1].getGlobalIndex() == 1);
@@ -669,10 +736,10 @@ BOOST_AUTO_TEST_CASE(RePartitionRBFLocal3D,
     BOOST_TEST(pMesh->edges().size() == 6);
     BOOST_TEST(pMesh->triangles().size() == 2);
     BOOST_TEST(pMesh->vertices()[0].isOwner() == true);
-    BOOST_TEST(pMesh->vertices()[1].isOwner() == true);
-    BOOST_TEST(pMesh->vertices()[2].isOwner() == false);
+    BOOST_TEST(pMesh->vertices()[1].isOwner() == false);
+    BOOST_TEST(pMesh->vertices()[2].isOwner() == true);
     BOOST_TEST(pMesh->vertices()[3].isOwner() == false);
-    BOOST_TEST(pMesh->vertices()[4].isOwner() == false);
+    BOOST_TEST(pMesh->vertices()[4].isOwner() == true);
     BOOST_TEST(pMesh->vertices()[0].getGlobalIndex() == 0);
     BOOST_TEST(pMesh->vertices()[1].getGlobalIndex() == 1);
     BOOST_TEST(pMesh->vertices()[2].getGlobalIndex() == 2);
@@ -687,10 +754,10 @@ BOOST_AUTO_TEST_CASE(RePartitionRBFLocal3D,
     BOOST_TEST(pMesh->edges().size() == 6);
     BOOST_TEST(pMesh->triangles().size() == 2);
     BOOST_TEST(pMesh->vertices()[0].isOwner() == false);
-    BOOST_TEST(pMesh->vertices()[1].isOwner() == false);
-    BOOST_TEST(pMesh->vertices()[2].isOwner() == true);
+    BOOST_TEST(pMesh->vertices()[1].isOwner() == true);
+    BOOST_TEST(pMesh->vertices()[2].isOwner() == false);
     BOOST_TEST(pMesh->vertices()[3].isOwner() == true);
-    BOOST_TEST(pMesh->vertices()[4].isOwner() == true);
+    BOOST_TEST(pMesh->vertices()[4].isOwner() == false);
     BOOST_TEST(pMesh->vertices()[0].getGlobalIndex() == 0);
     BOOST_TEST(pMesh->vertices()[1].getGlobalIndex() == 1);
     BOOST_TEST(pMesh->vertices()[2].getGlobalIndex() == 2);
@@ -181,6 +181,17 @@ void SolverInterface:: getMeshVertexIDsFromPositions
   _impl->getMeshVertexIDsFromPositions(meshID, size, positions, ids);
 }
 
+void SolverInterface:: getMeshVertexIDsFromPositions
+(
+  int               meshID,
+  int               size,
+  double*           positions,
+  int*              ids,
+  std::vector<int>& unmatched )
+{
+  _impl->getMeshVertexIDsFromPositions(meshID, size, positions, ids, unmatched);
+}
+
 int SolverInterface:: setMeshEdge
 (
   int meshID,
@@ -210,6 +221,15 @@ void SolverInterface:: setMeshTriangleWithEdges
   _impl->setMeshTriangleWithEdges ( meshID, firstVertexID, secondVertexID, thirdVertexID );
 }
 
+void SolverInterface:: setMeshTrianglesWithEdges
+(
+  int  meshID,
+  int  size,
+  int* vertexIDs )
+{
+  _impl->setMeshTrianglesWithEdges(meshID, size, vertexIDs);
+}
+
 void SolverInterface:: setMeshQuad
 (
   int meshID,
@@ -233,6 +253,15 @@ void SolverInterface:: setMeshQuadWithEdges
                               fourthVertexID);
 }
 
+void SolverInterface:: setMeshQuadsWithEdges
+(
+  int  meshID,
+  int  size,
+  int* vertexIDs )
+{
+  _impl->setMeshQuadsWithEdges(meshID, size, vertexIDs);
+}
+
 void SolverInterface:: mapReadDataTo
 (
   int toMeshID )
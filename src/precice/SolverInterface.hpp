@@ -42,6 +42,8 @@ namespace PreciceTests {
     struct testBug;
     struct testThreeSolvers;
     struct testMultiCoupling;
+    struct testGetMeshVertexIDsFromPositions;
+    struct testSetMeshElementsWithEdges;
   }
   namespace Server {
     struct testCouplingModeWithOneServer;
@@ -363,6 +365,9 @@ public:
   /**
    * @brief Gets mesh vertex IDs from positions.
    *
+   * The positions are looked up in a spatial index of the mesh vertices.
+   * If positions do not match any vertex, all of them are reported in one error.
+   *
    * @param[in] size Number of positions, ids.
    * @param[in] positions Positions (x,y,z,x,y,z,...) to find ids for.
    * @param[in] ids IDs corresponding to positions.
@@ -373,6 +378,21 @@ public:
     double* positions,
     int*    ids );
 
+  /**
+   * @brief Gets mesh vertex IDs from positions, reporting unmatched positions instead of aborting.
+   *
+   * @param[in] size Number of positions, ids.
+   * @param[in] positions Positions (x,y,z,x,y,z,...) to find ids for.
+   * @param[out] ids IDs corresponding to positions, -1 for positions not matching any vertex.
+   * @param[out] unmatched Indices of the positions not matching any vertex.
+   */
+  void getMeshVertexIDsFromPositions (
+    int               meshID,
+    int               size,
+    double*           positions,
+    int*              ids,
+    std::vector<int>& unmatched );
+
   /**
    * @brief Sets surface mesh edge from vertex IDs, returns edge ID.
    */
@@ -395,7 +415,7 @@ public:
    *
    * This routine is supposed to be used, when no edge information is available
    * per se. Edges are created on the fly within preCICE. This routine is
-   * significantly slower than the one using edge IDs, since it needs to check,
+   * slightly slower than the one using edge IDs, since it needs to look up,
    * whether an edge is created already or not.
    */
   void setMeshTriangleWithEdges (
@@ -404,6 +424,22 @@ public:
     int secondVertexID,
     int thirdVertexID );
 
+  /**
+   * @brief Sets several surface mesh triangles from vertex IDs.
+   *
+   * Same as setMeshTriangleWithEdges(), but for a whole connectivity array
+   * at once. Edges are looked up in a hash index of the mesh, hence the costs
+   * are linear in the number of triangles.
+   *
+   * @param[in] meshID ID of the mesh the triangles belong to
+   * @param[in] size Number of triangles
+   * @param[in] vertexIDs Vertex IDs of the triangles, format is (t0v0, t0v1, t0v2, t1v0, ...)
+   */
+  void setMeshTrianglesWithEdges (
+    int  meshID,
+    int  size,
+    int* vertexIDs );
+
   /**
    * @brief Sets surface mesh quadrangle from edge IDs.
    */
@@ -419,7 +455,7 @@ public:
    *
    * This routine is supposed to be used, when no edge information is available
    * per se. Edges are created on the fly within preCICE. This routine is
-   * significantly slower than the one using edge IDs, since it needs to check,
+   * slightly slower than the one using edge IDs, since it needs to look up,
    * whether an edge is created already or not.
    */
   void setMeshQuadWithEdges (
@@ -429,6 +465,20 @@ public:
     int thirdVertexID,
     int fourthVertexID );
 
+  /**
+   * @brief Sets several surface mesh quadrangles from vertex IDs.
+   *
+   * Same as setMeshQuadWithEdges(), but for a whole connectivity array at once.
+   *
+   * @param[in] meshID ID of the mesh the quadrangles belong to
+   * @param[in] size Number of quadrangles
+   * @param[in] vertexIDs Vertex IDs of the quadrangles, format is (q0v0, q0v1, q0v2, q0v3, q1v0, ...)
+   */
+  void setMeshQuadsWithEdges (
+    int  meshID,
+    int  size,
+    int* vertexIDs );
+
   /**
    * @brief Computes and maps all read data mapped to the mesh with given ID.
    *
@@ -599,6 +649,8 @@ private:
   friend struct PreciceTests::Serial::testBug;
   friend struct PreciceTests::Serial::testThreeSolvers;
   friend struct PreciceTests::Serial::testMultiCoupling;
+  friend struct PreciceTests::Serial::testGetMeshVertexIDsFromPositions;
+  friend struct PreciceTests::Serial::testSetMeshElementsWithEdges;
   friend struct PreciceTests::Server::testCouplingModeWithOneServer;
   friend struct PreciceTests::Server::testCouplingModeParallelWithOneServer;
 
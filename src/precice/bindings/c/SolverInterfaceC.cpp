@@ -200,6 +200,26 @@ void precicec_setMeshTriangleWithEdges
   impl->setMeshTriangleWithEdges ( meshID, firstVertexID, secondVertexID, thirdVertexID );
 }
 
+void precicec_setMeshTrianglesWithEdges
+(
+  int  meshID,
+  int  size,
+  int* vertexIDs )
+{
+  assertion ( impl != nullptr );
+  impl->setMeshTrianglesWithEdges ( meshID, size, vertexIDs );
+}
+
+void precicec_setMeshQuadsWithEdges
+(
+  int  meshID,
+  int  size,
+  int* vertexIDs )
+{
+  assertion ( impl != nullptr );
+  impl->setMeshQuadsWithEdges ( meshID, size, vertexIDs );
+}
+
 void precicec_writeBlockVectorData
 (
   int     dataID,
@@ -131,6 +131,22 @@ void precicec_setMeshTriangleWithEdges (
   int secondVertexID,
   int thirdVertexID );
 
+/**
+ * @brief Sets several triangles from vertex IDs (three per triangle). Creates missing edges.
+ */
+void precicec_setMeshTrianglesWithEdges (
+  int  meshID,
+  int  size,
+  int* vertexIDs );
+
+/**
+ * @brief Sets several quads from vertex IDs (four per quad). Creates missing edges.
+ */
+void precicec_setMeshQuadsWithEdges (
+  int  meshID,
+  int  size,
+  int* vertexIDs );
+
 /**
  * @brief Writes vector data values given as block.
  *
@@ -257,6 +257,26 @@ void precicef_set_triangle_we_
   impl->setMeshTriangleWithEdges(*meshID, *firstVertexID, *secondVertexID, *thirdVertexID);
 }
 
+void precicef_set_triangles_we_
+(
+  const int* meshID,
+  const int* size,
+  int*       vertexIDs )
+{
+  CHECK(impl != nullptr,errormsg);
+  impl->setMeshTrianglesWithEdges(*meshID, *size, vertexIDs);
+}
+
+void precicef_set_quads_we_
+(
+  const int* meshID,
+  const int* size,
+  int*       vertexIDs )
+{
+  CHECK(impl != nullptr,errormsg);
+  impl->setMeshQuadsWithEdges(*meshID, *size, vertexIDs);
+}
+
 void precicef_write_bvdata_
 (
   const int* dataID,
@@ -307,6 +307,40 @@ void precicef_set_triangle_we_(
   const int* secondVertexID,
   const int* thirdVertexID );
 
+/**
+ * @brief See precice::SolverInterface::setMeshTrianglesWithEdges().
+ *
+ * Fortran syntax:
+ * precicef_set_triangles_we(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER vertexIDs(3*size) )
+ *
+ * IN:  meshID, size, vertexIDs
+ * OUT: -
+ */
+void precicef_set_triangles_we_(
+  const int* meshID,
+  const int* size,
+  int*       vertexIDs );
+
+/**
+ * @brief See precice::SolverInterface::setMeshQuadsWithEdges().
+ *
+ * Fortran syntax:
+ * precicef_set_quads_we(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER vertexIDs(4*size) )
+ *
+ * IN:  meshID, size, vertexIDs
+ * OUT: -
+ */
+void precicef_set_quads_we_(
+  const int* meshID,
+  const int* size,
+  int*       vertexIDs );
+
 /**
  * @brief See precice::SolverInterface::writeBlockVectorData.
  *
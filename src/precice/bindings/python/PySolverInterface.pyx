@@ -61,10 +61,14 @@ cdef extern from "./src/precice/SolverInterface.hpp"  namespace "precice":
 
       void setMeshTriangleWithEdges (int meshID, int firstVertexID, int secondVertexID, int thirdVertexID)
 
+      void setMeshTrianglesWithEdges (int meshID, int size, int* vertexIDs)
+
       void setMeshQuad (int meshID, int firstEdgeID, int secondEdgeID, int thirdEdgeID, int fourthEdgeID)
 
       void setMeshQuadWithEdges (int meshID, int firstVertexID, int secondVertexID, int thirdVertexID, int fourthVertexID)
 
+      void setMeshQuadsWithEdges (int meshID, int size, int* vertexIDs)
+
       void mapReadDataTo (int toMeshID)
 
       void mapWriteDataFrom (int fromMeshID)
@@ -233,12 +237,40 @@ cdef class PySolverInterface:
    def setMeshTriangleWithEdges (self, meshID, firstVertexID, secondVertexID, thirdVertexID):
       self.thisptr.setMeshTriangleWithEdges (meshID, firstVertexID, secondVertexID, thirdVertexID)
 
+   def setMeshTrianglesWithEdges (self, meshID, size, vertexIDs):
+      cdef int* vertexIDs_
+      vertexIDs_ = <int*> malloc(len(vertexIDs) * sizeof(int))
+
+      if vertexIDs_ is NULL:
+         raise MemoryError()
+
+      for i in xrange(len(vertexIDs)):
+         vertexIDs_[i] = vertexIDs[i]
+
+      self.thisptr.setMeshTrianglesWithEdges (meshID, size, vertexIDs_)
+
+      free(vertexIDs_)
+
    def setMeshQuad (self, int meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID):
       self.thisptr.setMeshQuad (meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID)
 
    def setMeshQuadWithEdges (self, meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID):
       self.thisptr.setMeshQuadWithEdges (meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID)
 
+   def setMeshQuadsWithEdges (self, meshID, size, vertexIDs):
+      cdef int* vertexIDs_
+      vertexIDs_ = <int*> malloc(len(vertexIDs) * sizeof(int))
+
+      if vertexIDs_ is NULL:
+         raise MemoryError()
+
+      for i in xrange(len(vertexIDs)):
+         vertexIDs_[i] = vertexIDs[i]
+
+      self.thisptr.setMeshQuadsWithEdges (meshID, size, vertexIDs_)
+
+      free(vertexIDs_)
+
    def mapReadDataTo (self, toMeshID):
       self.thisptr.mapReadDataTo (toMeshID)
 
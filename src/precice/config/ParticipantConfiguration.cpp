@@ -17,6 +17,7 @@
 #include "com/MPIPortsCommunication.hpp"
 #include "io/ExportVTK.hpp"
 #include "io/ExportVTKXML.hpp"
+#include "io/ExportAsync.hpp"
 #include "io/ExportContext.hpp"
 #include "io/SharedPointer.hpp"
 #include "partition/ReceivedPartition.hpp"
@@ -318,6 +319,8 @@ ParticipantConfiguration:: ParticipantConfiguration
     doc += " the communication between the Master and all slaves. ";
     doc += "The communication between Master and slaves is done by mpi ";
     doc += "with startup in one communication spaces. (This choice is recommended)";
+    doc += " Reductions and broadcasts among the ranks are then done by MPI collectives, ";
+    doc += "while sockets and mpi gather them at the Master.";
     tagMaster.setDocumentation(doc);
 
     masterTags.push_back(tagMaster);
@@ -624,7 +627,7 @@ void ParticipantConfiguration:: finishParticipantConfiguration
     io::PtrExport exporter;
     if (context.type == VALUE_VTK){
       if(_participants.back()->useMaster()){
-        exporter = io::PtrExport(new io::ExportVTKXML(context.plotNormals));
+        exporter = io::PtrExport(new io::ExportVTKXML(context.plotNormals, context.writeBinary));
       }
       else{
         exporter = io::PtrExport(new io::ExportVTK(context.plotNormals));
@@ -633,6 +636,9 @@ void ParticipantConfiguration:: finishParticipantConfiguration
     else {
       ERROR("Unknown export type!");
     }
+    if (context.asynchronous){
+      exporter = io::PtrExport(new io::ExportAsync(exporter, context.queueSize, context.dropWhenFull));
+    }
     context.exporter = exporter;
 
     _participants.back()->addExportContext(context);
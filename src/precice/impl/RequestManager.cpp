@@ -3,6 +3,7 @@
 #include "cplscheme/CouplingScheme.hpp"
 #include "precice/impl/SolverInterfaceImpl.hpp"
 #include <algorithm>
+#include <vector>
 
 namespace precice {
 namespace impl {
@@ -132,6 +133,10 @@ void RequestManager:: handleRequests()
       handleRequestSetMeshTriangleWithEdges(rankSender);
       singleRequest = true;
       break;
+    case REQUEST_SET_MESH_TRIANGLES_WITH_EDGES:
+      handleRequestSetMeshTrianglesWithEdges(rankSender);
+      singleRequest = true;
+      break;
     case REQUEST_SET_MESH_QUAD:
       handleRequestSetMeshQuad(rankSender);
       singleRequest = true;
@@ -140,6 +145,10 @@ void RequestManager:: handleRequests()
       handleRequestSetMeshQuadWithEdges(rankSender);
       singleRequest = true;
       break;
+    case REQUEST_SET_MESH_QUADS_WITH_EDGES:
+      handleRequestSetMeshQuadsWithEdges(rankSender);
+      singleRequest = true;
+      break;
     case REQUEST_WRITE_BLOCK_SCALAR_DATA:
       handleRequestWriteBlockScalarData(rankSender);
       singleRequest = true;
@@ -395,6 +404,19 @@ void RequestManager:: requestSetMeshTriangleWithEdges
   _com->send(data, 4, 0);
 }
 
+void RequestManager:: requestSetMeshTrianglesWithEdges
+(
+  int  meshID,
+  int  size,
+  int* vertexIDs )
+{
+  TRACE(meshID, size);
+  _com->send(REQUEST_SET_MESH_TRIANGLES_WITH_EDGES, 0);
+  _com->send(meshID, 0);
+  _com->send(size, 0);
+  _com->send(vertexIDs, 3*size, 0);
+}
+
 void RequestManager:: requestSetMeshQuad
 (
   int meshID,
@@ -423,6 +445,19 @@ void RequestManager:: requestSetMeshQuadWithEdges
   _com->send(data, 5, 0);
 }
 
+void RequestManager:: requestSetMeshQuadsWithEdges
+(
+  int  meshID,
+  int  size,
+  int* vertexIDs )
+{
+  TRACE(meshID, size);
+  _com->send(REQUEST_SET_MESH_QUADS_WITH_EDGES, 0);
+  _com->send(meshID, 0);
+  _com->send(size, 0);
+  _com->send(vertexIDs, 4*size, 0);
+}
+
 void RequestManager:: requestWriteBlockScalarData (
   int     dataID,
   int     size,
@@ -700,7 +735,9 @@ void RequestManager:: handleRequestGetMeshVertexIDsFromPositions
   int* ids = new int[size];
   double* positions = new double[size*_interface.getDimensions()];
   _com->receive(positions, size*_interface.getDimensions(), rankSender);
-  _interface.getMeshVertexIDsFromPositions(meshID, size, positions, ids);
+  // Unknown positions are sent back as ID -1 and reported by the client
+  std::vector<int> unmatched;
+  _interface.getMeshVertexIDsFromPositions(meshID, size, positions, ids, unmatched);
   _com->send(ids, size, rankSender);
   delete[] ids;
   delete[] positions;
@@ -737,6 +774,21 @@ void RequestManager:: handleRequestSetMeshTriangleWithEdges
   _interface.setMeshTriangleWithEdges(data[0], data[1], data[2], data[3]);
 }
 
+void RequestManager:: handleRequestSetMeshTrianglesWithEdges
+(
+  int rankSender )
+{
+  TRACE(rankSender);
+  int meshID = -1;
+  int size = -1;
+  _com->receive(meshID, rankSender);
+  _com->receive(size, rankSender);
+  CHECK(size > 0, "You cannot call setMeshTrianglesWithEdges with size=0.");
+  std::vector<int> vertexIDs(3*size);
+  _com->receive(vertexIDs.data(), 3*size, rankSender);
+  _interface.setMeshTrianglesWithEdges(meshID, size, vertexIDs.data());
+}
+
 void RequestManager:: handleRequestSetMeshQuad
 (
   int rankSender )
@@ -757,6 +809,21 @@ void RequestManager:: handleRequestSetMeshQuadWithEdges
   _interface.setMeshQuadWithEdges(data[0], data[1], data[2], data[3], data[4]);
 }
 
+void RequestManager:: handleRequestSetMeshQuadsWithEdges
+(
+  int rankSender )
+{
+  TRACE(rankSender);
+  int meshID = -1;
+  int size = -1;
+  _com->receive(meshID, rankSender);
+  _com->receive(size, rankSender);
+  CHECK(size > 0, "You cannot call setMeshQuadsWithEdges with size=0.");
+  std::vector<int> vertexIDs(4*size);
+  _com->receive(vertexIDs.data(), 4*size, rankSender);
+  _interface.setMeshQuadsWithEdges(meshID, size, vertexIDs.data());
+}
+
 void RequestManager:: handleRequestWriteScalarData
 (
   int rankSender )
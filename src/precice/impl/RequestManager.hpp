@@ -99,6 +99,12 @@ public:
     int secondVertexID,
     int thirdVertexID );
 
+  /// Requests set mesh triangles with edges from server.
+  void requestSetMeshTrianglesWithEdges (
+    int  meshID,
+    int  size,
+    int* vertexIDs );
+
   /// Requests set mesh quad from server.
   void requestSetMeshQuad (
     int meshID,
@@ -115,6 +121,12 @@ public:
     int thirdVertexID,
     int fourthVertexID );
 
+  /// Requests set mesh quads with edges from server.
+  void requestSetMeshQuadsWithEdges (
+    int  meshID,
+    int  size,
+    int* vertexIDs );
+
   /// Requests write block scalar data from server.
   void requestWriteBlockScalarData (
     int     dataID,
@@ -191,8 +203,10 @@ private:
     REQUEST_SET_MESH_EDGE,
     REQUEST_SET_MESH_TRIANGLE,
     REQUEST_SET_MESH_TRIANGLE_WITH_EDGES,
+    REQUEST_SET_MESH_TRIANGLES_WITH_EDGES,
     REQUEST_SET_MESH_QUAD,
     REQUEST_SET_MESH_QUAD_WITH_EDGES,
+    REQUEST_SET_MESH_QUADS_WITH_EDGES,
     REQUEST_WRITE_SCALAR_DATA,
     REQUEST_WRITE_BLOCK_SCALAR_DATA,
     REQUEST_WRITE_VECTOR_DATA,
@@ -256,12 +270,18 @@ private:
   /// Handles request set mesh triangle with edges from client.
   void handleRequestSetMeshTriangleWithEdges ( int rankSender );
 
+  /// Handles request set mesh triangles with edges from client.
+  void handleRequestSetMeshTrianglesWithEdges ( int rankSender );
+
   /// Handles request set mesh quad from client.
   void handleRequestSetMeshQuad ( int rankSender );
 
   /// Handles request set mesh quad with edges from client.
   void handleRequestSetMeshQuadWithEdges ( int rankSender );
 
+  /// Handles request set mesh quads with edges from client.
+  void handleRequestSetMeshQuadsWithEdges ( int rankSender );
+
   /// Handles request write block scalar data from client.
   void handleRequestWriteBlockScalarData ( int rankSender );
 
@@ -14,6 +14,7 @@
 #include "mesh/Edge.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Merge.hpp"
+#include "mesh/RTree.hpp"
 #include "io/ExportContext.hpp"
 #include "io/Export.hpp"
 #include "com/MPIPortsCommunication.hpp"
@@ -30,8 +31,11 @@
 #include "utils/Petsc.hpp"
 #include "utils/MasterSlave.hpp"
 #include "mapping/Mapping.hpp"
+#include <algorithm>
 #include <set>
+#include <sstream>
 #include <Eigen/Core>
+#include <boost/function_output_iterator.hpp>
 #include "partition/ReceivedPartition.hpp"
 #include "partition/ProvidedPartition.hpp"
 
@@ -50,6 +54,82 @@ bool testMode = false;
 
 namespace impl {
 
+namespace {
+
+/// Returns the edge between the two vertices, creates it if it does not exist yet.
+mesh::Edge& getOrCreateEdge
+(
+  mesh::Mesh&   mesh,
+  mesh::Vertex& vertexOne,
+  mesh::Vertex& vertexTwo )
+{
+  mesh::Edge* edge = mesh.findEdge(vertexOne.getID(), vertexTwo.getID());
+  if (edge == nullptr){
+    edge = & mesh.createEdge(vertexOne, vertexTwo);
+  }
+  return *edge;
+}
+
+/// Creates a triangle from vertex IDs, missing edges are created.
+void createTriangleWithEdges
+(
+  mesh::Mesh& mesh,
+  int         firstVertexID,
+  int         secondVertexID,
+  int         thirdVertexID )
+{
+  assertion(firstVertexID >= 0, firstVertexID);
+  assertion(secondVertexID >= 0, secondVertexID);
+  assertion(thirdVertexID >= 0, thirdVertexID);
+  assertion((int)mesh.vertices().size() > firstVertexID,
+              mesh.vertices().size(), firstVertexID);
+  assertion((int)mesh.vertices().size() > secondVertexID,
+              mesh.vertices().size(), secondVertexID);
+  assertion((int)mesh.vertices().size() > thirdVertexID,
+              mesh.vertices().size(), thirdVertexID);
+  mesh::Vertex& v0 = mesh.vertices()[firstVertexID];
+  mesh::Vertex& v1 = mesh.vertices()[secondVertexID];
+  mesh::Vertex& v2 = mesh.vertices()[thirdVertexID];
+  mesh::Edge& e0 = getOrCreateEdge(mesh, v0, v1);
+  mesh::Edge& e1 = getOrCreateEdge(mesh, v1, v2);
+  mesh::Edge& e2 = getOrCreateEdge(mesh, v2, v0);
+  mesh.createTriangle(e0, e1, e2);
+}
+
+/// Creates a quad from vertex IDs, missing edges are created.
+void createQuadWithEdges
+(
+  mesh::Mesh& mesh,
+  int         firstVertexID,
+  int         secondVertexID,
+  int         thirdVertexID,
+  int         fourthVertexID )
+{
+  assertion(firstVertexID >= 0, firstVertexID);
+  assertion(secondVertexID >= 0, secondVertexID);
+  assertion(thirdVertexID >= 0, thirdVertexID);
+  assertion(fourthVertexID >= 0, fourthVertexID);
+  assertion((int)mesh.vertices().size() > firstVertexID,
+               mesh.vertices().size(), firstVertexID);
+  assertion((int)mesh.vertices().size() > secondVertexID,
+               mesh.vertices().size(), secondVertexID);
+  assertion((int)mesh.vertices().size() > thirdVertexID,
+               mesh.vertices().size(), thirdVertexID);
+  assertion((int)mesh.vertices().size() > fourthVertexID,
+               mesh.vertices().size(), fourthVertexID);
+  mesh::Vertex& v0 = mesh.vertices()[firstVertexID];
+  mesh::Vertex& v1 = mesh.vertices()[secondVertexID];
+  mesh::Vertex& v2 = mesh.vertices()[thirdVertexID];
+  mesh::Vertex& v3 = mesh.vertices()[fourthVertexID];
+  mesh::Edge& e0 = getOrCreateEdge(mesh, v0, v1);
+  mesh::Edge& e1 = getOrCreateEdge(mesh, v1, v2);
+  mesh::Edge& e2 = getOrCreateEdge(mesh, v2, v3);
+  mesh::Edge& e3 = getOrCreateEdge(mesh, v3, v0);
+  mesh.createQuad(e0, e1, e2, e3);
+}
+
+}
+
 SolverInterfaceImpl:: SolverInterfaceImpl
 (
   const std::string& participantName,
@@ -400,6 +480,10 @@ void SolverInterfaceImpl:: finalize()
         }
       }
     }
+    // Exports written in the background have to be complete before finalize() returns
+    for (const io::ExportContext& context : _accessor->exportContexts()){
+      context.exporter->flush();
+    }
     // Apply some final ping-pong to synch solver that run e.g. with a uni-directional coupling only
     // afterwards close connections
     std::string ping = "ping";
@@ -688,31 +772,58 @@ void SolverInterfaceImpl:: getMeshVertexIDsFromPositions (
   size_t  size,
   double* positions,
   int*    ids )
+{
+  TRACE(meshID, size);
+  std::vector<int> unmatched;
+  getMeshVertexIDsFromPositions(meshID, size, positions, ids, unmatched);
+  if (not unmatched.empty()){
+    std::ostringstream unknownPositions;
+    for (int i : unmatched){
+      unknownPositions << "\n  Position " << i << " =";
+      for (int dim=0; dim < _dimensions; dim++){
+        unknownPositions << " " << positions[i*_dimensions+dim];
+      }
+    }
+    ERROR(unmatched.size() << " of " << size << " positions are unknown on mesh \""
+          << _accessor->meshContext(meshID).mesh->getName() << "\":" << unknownPositions.str());
+  }
+}
+
+void SolverInterfaceImpl:: getMeshVertexIDsFromPositions (
+  int               meshID,
+  size_t            size,
+  double*           positions,
+  int*              ids,
+  std::vector<int>& unmatched )
 {
   TRACE(meshID, size);
   if (_clientMode){
+    // The server marks unmatched positions by ID -1
     _requestManager->requestGetMeshVertexIDsFromPositions(meshID, size, positions, ids);
   }
   else {
     MeshContext& context = _accessor->meshContext(meshID);
     mesh::PtrMesh mesh(context.mesh);
     DEBUG("Get IDs");
-    Eigen::VectorXd internalPosition(_dimensions);
+    mesh::rtree::PtrRTree tree = mesh::rtree::getVertexRTree(mesh);
     Eigen::VectorXd position(_dimensions);
-    assertion(mesh->vertices().size() <= size, mesh->vertices().size(), size);
     for (size_t i=0; i < size; i++){
       for (int dim=0; dim < _dimensions; dim++){
         position[dim] = positions[i*_dimensions+dim];
       }
-      size_t j=0;
-      for (j=0; j < mesh->vertices().size(); j++){
-        internalPosition = mesh->vertices()[j].getCoords();
-        if (math::equals(internalPosition, position)){
-          ids[i] = j;
-          break;
-        }
-      }
-      CHECK(j < mesh->vertices().size(), "Position " << i << "=" << position << " unknown!");
+      ids[i] = -1;
+      tree->query(boost::geometry::index::nearest(position, 1),
+                  boost::make_function_output_iterator([&](size_t index) {
+                      if (math::equals(mesh->vertices()[index].getCoords(), position)){
+                        ids[i] = mesh->vertices()[index].getID();
+                      }
+                    }));
+    }
+  }
+  unmatched.clear();
+  for (size_t i=0; i < size; i++){
+    if (ids[i] == -1){
+      unmatched.push_back(i);
     }
   }
 }
@@ -799,79 +910,28 @@ void SolverInterfaceImpl:: setMeshTriangleWithEdges
   CHECK(not _couplingScheme->isInitialized(), "Triangles can only be defined before initialize() is called");
   MeshContext& context = _accessor->meshContext(meshID);
   if (context.meshRequirement == mapping::Mapping::FULL){
-    mesh::PtrMesh& mesh = context.mesh;
-    assertion(firstVertexID >= 0, firstVertexID);
-    assertion(secondVertexID >= 0, secondVertexID);
-    assertion(thirdVertexID >= 0, thirdVertexID);
-    assertion((int)mesh->vertices().size() > firstVertexID,
-                mesh->vertices().size(), firstVertexID);
-    assertion((int)mesh->vertices().size() > secondVertexID,
-                mesh->vertices().size(), secondVertexID);
-    assertion((int)mesh->vertices().size() > thirdVertexID,
-                 mesh->vertices().size(), thirdVertexID);
-    mesh::Vertex* vertices[3];
-    vertices[0] = &mesh->vertices()[firstVertexID];
-    vertices[1] = &mesh->vertices()[secondVertexID];
-    vertices[2] = &mesh->vertices()[thirdVertexID];
-    mesh::Edge* edges[3];
-    edges[0] = nullptr;
-    edges[1] = nullptr;
-    edges[2] = nullptr;
-    for (mesh::Edge& edge : mesh->edges()) {
-      // Check edge 0
-      bool foundEdge = edge.vertex(0).getID() == vertices[0]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[1]->getID();
-      if (foundEdge){
-        edges[0] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[1]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[0]->getID();
-      if (foundEdge){
-        edges[0] = &edge;
-        continue;
-      }
-
-      // Check edge 1
-      foundEdge = edge.vertex(0).getID() == vertices[1]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[2]->getID();
-      if (foundEdge){
-        edges[1] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[2]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[1]->getID();
-      if (foundEdge){
-        edges[1] = &edge;
-        continue;
-      }
+    createTriangleWithEdges(*context.mesh, firstVertexID, secondVertexID, thirdVertexID);
+  }
+}
 
-      // Check edge 2
-      foundEdge = edge.vertex(0).getID() == vertices[2]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[0]->getID();
-      if (foundEdge){
-        edges[2] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[0]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[2]->getID();
-      if (foundEdge){
-        edges[2] = &edge;
-        continue;
-      }
-    }
-    // Create missing edges
-    if (edges[0] == nullptr){
-      edges[0] = & mesh->createEdge(*vertices[0], *vertices[1]);
-    }
-    if (edges[1] == nullptr){
-      edges[1] = & mesh->createEdge(*vertices[1], *vertices[2]);
-    }
-    if (edges[2] == nullptr){
-      edges[2] = & mesh->createEdge(*vertices[2], *vertices[0]);
+void SolverInterfaceImpl:: setMeshTrianglesWithEdges
+(
+  int  meshID,
+  int  size,
+  int* vertexIDs )
+{
+  TRACE(meshID, size);
+  if (_clientMode){
+    _requestManager->requestSetMeshTrianglesWithEdges(meshID, size, vertexIDs);
+    return;
+  }
+  CHECK(not _couplingScheme->isInitialized(), "Triangles can only be defined before initialize() is called");
+  MeshContext& context = _accessor->meshContext(meshID);
+  if (context.meshRequirement == mapping::Mapping::FULL){
+    mesh::Mesh& mesh = *context.mesh;
+    for (int i = 0; i < size; i++){
+      createTriangleWithEdges(mesh, vertexIDs[3*i], vertexIDs[3*i+1], vertexIDs[3*i+2]);
     }
-
-    mesh->createTriangle(*edges[0], *edges[1], *edges[2]);
   }
 }
 
@@ -929,101 +989,30 @@ void SolverInterfaceImpl:: setMeshQuadWithEdges
   CHECK(not _couplingScheme->isInitialized(), "Quads can only be defined before initialize() is called");
   MeshContext& context = _accessor->meshContext(meshID);
   if (context.meshRequirement == mapping::Mapping::FULL){
-    mesh::PtrMesh& mesh = context.mesh;
-    assertion(firstVertexID >= 0, firstVertexID);
-    assertion(secondVertexID >= 0, secondVertexID);
-    assertion(thirdVertexID >= 0, thirdVertexID);
-    assertion(fourthVertexID >= 0, fourthVertexID);
-    assertion((int)mesh->vertices().size() > firstVertexID,
-                 mesh->vertices().size(), firstVertexID);
-    assertion((int)mesh->vertices().size() > secondVertexID,
-                 mesh->vertices().size(), secondVertexID);
-    assertion((int)mesh->vertices().size() > thirdVertexID,
-                 mesh->vertices().size(), thirdVertexID);
-    assertion((int)mesh->vertices().size() > fourthVertexID,
-                 mesh->vertices().size(), fourthVertexID);
-    mesh::Vertex* vertices[4];
-    vertices[0] = &mesh->vertices()[firstVertexID];
-    vertices[1] = &mesh->vertices()[secondVertexID];
-    vertices[2] = &mesh->vertices()[thirdVertexID];
-    vertices[3] = &mesh->vertices()[fourthVertexID];
-    mesh::Edge* edges[4];
-    edges[0] = nullptr;
-    edges[1] = nullptr;
-    edges[2] = nullptr;
-    edges[3] = nullptr;
-    for (mesh::Edge& edge : mesh->edges()) {
-      // Check edge 0
-      bool foundEdge = edge.vertex(0).getID() == vertices[0]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[1]->getID();
-      if ( foundEdge ){
-        edges[0] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[1]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[0]->getID();
-      if (foundEdge){
-        edges[0] = &edge;
-        continue;
-      }
-
-      // Check edge 1
-      foundEdge = edge.vertex(0).getID() == vertices[1]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[2]->getID();
-      if ( foundEdge ){
-        edges[1] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[2]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[1]->getID();
-      if ( foundEdge ){
-        edges[1] = &edge;
-        continue;
-      }
-
-      // Check edge 2
-      foundEdge = edge.vertex(0).getID() == vertices[2]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[3]->getID();
-      if ( foundEdge ){
-        edges[2] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[3]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[2]->getID();
-      if ( foundEdge ){
-        edges[2] = &edge;
-        continue;
-      }
+    createQuadWithEdges(*context.mesh, firstVertexID, secondVertexID,
+                        thirdVertexID, fourthVertexID);
+  }
+}
 
-      // Check edge 3
-      foundEdge = edge.vertex(0).getID() == vertices[3]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[0]->getID();
-      if ( foundEdge ){
-        edges[3] = &edge;
-        continue;
-      }
-      foundEdge = edge.vertex(0).getID() == vertices[0]->getID();
-      foundEdge &= edge.vertex(1).getID() == vertices[3]->getID();
-      if ( foundEdge ){
-        edges[3] = &edge;
-        continue;
-      }
-    }
-    // Create missing edges
-    if (edges[0] == nullptr){
-      edges[0] = & mesh->createEdge(*vertices[0], *vertices[1]);
-    }
-    if (edges[1] == nullptr){
-      edges[1] = & mesh->createEdge(*vertices[1], *vertices[2]);
-    }
-    if (edges[2] == nullptr){
-      edges[2] = & mesh->createEdge(*vertices[2], *vertices[3]);
-    }
-    if (edges[3] == nullptr){
-      edges[3] = & mesh->createEdge(*vertices[3], *vertices[0]);
+void SolverInterfaceImpl:: setMeshQuadsWithEdges
+(
+  int  meshID,
+  int  size,
+  int* vertexIDs )
+{
+  TRACE(meshID, size);
+  if (_clientMode){
+    _requestManager->requestSetMeshQuadsWithEdges(meshID, size, vertexIDs);
+    return;
+  }
+  CHECK(not _couplingScheme->isInitialized(), "Quads can only be defined before initialize() is called");
+  MeshContext& context = _accessor->meshContext(meshID);
+  if (context.meshRequirement == mapping::Mapping::FULL){
+    mesh::Mesh& mesh = *context.mesh;
+    for (int i = 0; i < size; i++){
+      createQuadWithEdges(mesh, vertexIDs[4*i], vertexIDs[4*i+1],
+                          vertexIDs[4*i+2], vertexIDs[4*i+3]);
     }
-
-    mesh->createQuad(*edges[0], *edges[1], *edges[2], *edges[3]);
   }
 }
 
@@ -1047,18 +1036,16 @@ void SolverInterfaceImpl:: mapWriteDataFrom
     DEBUG("Compute mapping from mesh \"" << context.mesh->getName() << "\"");
     mappingContext.mapping->computeMapping();
   }
+  std::vector<impl::DataContext*> contexts;
   for (impl::DataContext& context : _accessor->writeDataContexts()) {
     if (context.mesh->getID() == fromMeshID){
-      int inDataID = context.fromData->getID();
-      int outDataID = context.toData->getID();
-      context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
-      //assign(context.toData->values()) = 0.0;
       DEBUG("Map data \"" << context.fromData->getName()
                    << "\" from mesh \"" << context.mesh->getName() << "\"");
       assertion(mappingContext.mapping==context.mappingContext.mapping);
-      mappingContext.mapping->map(inDataID, outDataID);
+      contexts.push_back(&context);
     }
   }
+  mapDataContexts(contexts);
   mappingContext.hasMappedData = true;
 }
 
@@ -1083,26 +1070,16 @@ void SolverInterfaceImpl:: mapReadDataTo
     DEBUG("Compute mapping from mesh \"" << context.mesh->getName() << "\"");
     mappingContext.mapping->computeMapping();
   }
+  std::vector<impl::DataContext*> contexts;
   for (impl::DataContext& context : _accessor->readDataContexts()) {
     if (context.mesh->getID() == toMeshID){
-      int inDataID = context.fromData->getID();
-      int outDataID = context.toData->getID();
-      context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
-      //assign(context.toData->values()) = 0.0;
       DEBUG("Map data \"" << context.fromData->getName()
                    << "\" to mesh \"" << context.mesh->getName() << "\"");
       assertion(mappingContext.mapping==context.mappingContext.mapping);
-      mappingContext.mapping->map(inDataID, outDataID);
-#     ifndef NDEBUG
-      int max = context.toData->values().size();
-      std::ostringstream stream;
-      for (int i=0; (i < max) && (i < 10); i++){
-        stream << context.toData->values()[i] << " ";
-      }
-      DEBUG("First mapped values = " << stream.str());
-#     endif
+      contexts.push_back(&context);
     }
   }
+  mapDataContexts(contexts);
   mappingContext.hasMappedData = true;
 }
 
@@ -1539,6 +1516,7 @@ void SolverInterfaceImpl:: mapWrittenData()
   }
 
   // Map data
+  std::vector<impl::DataContext*> contexts;
   for (impl::DataContext& context : _accessor->writeDataContexts()) {
     timing = context.mappingContext.timing;
     bool hasMapping = context.mappingContext.mapping.get() != nullptr;
@@ -1546,24 +1524,12 @@ void SolverInterfaceImpl:: mapWrittenData()
     rightTime |= timing == MappingConfiguration::INITIAL;
     bool hasMapped = context.mappingContext.hasMappedData;
     if (hasMapping && rightTime && (not hasMapped)){
-      int inDataID = context.fromData->getID();
-      int outDataID = context.toData->getID();
       DEBUG("Map data \"" << context.fromData->getName()
                    << "\" from mesh \"" << context.mesh->getName() << "\"");
-      context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
-      //assign(context.toData->values()) = 0.0;
-      DEBUG("Map from dataID " << inDataID << " to dataID: " << outDataID);
-      context.mappingContext.mapping->map(inDataID, outDataID);
-#     ifndef NDEBUG
-      int max = context.toData->values().size();
-      std::ostringstream stream;
-      for (int i=0; (i < max) && (i < 10); i++){
-        stream << context.toData->values()[i] << " ";
-      }
-      DEBUG("First mapped values = " << stream.str() );
-#     endif
+      contexts.push_back(&context);
     }
   }
+  mapDataContexts(contexts);
 
   // Clear non-stationary, non-incremental mappings
   for (impl::MappingContext& context : _accessor->writeMappingContexts()) {
@@ -1598,6 +1564,7 @@ void SolverInterfaceImpl:: mapReadData()
   }
 
   // Map data
+  std::vector<impl::DataContext*> contexts;
   for (impl::DataContext& context : _accessor->readDataContexts()) {
     timing = context.mappingContext.timing;
     bool mapNow = timing == mapping::MappingConfiguration::ON_ADVANCE;
@@ -1605,23 +1572,12 @@ void SolverInterfaceImpl:: mapReadData()
     bool hasMapping = context.mappingContext.mapping.get() != nullptr;
     bool hasMapped = context.mappingContext.hasMappedData;
     if (mapNow && hasMapping && (not hasMapped)){
-      int inDataID = context.fromData->getID();
-      int outDataID = context.toData->getID();
-      context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
-      //assign(context.toData->values()) = 0.0;
       DEBUG("Map read data \"" << context.fromData->getName()
                    << "\" to mesh \"" << context.mesh->getName() << "\"");
-      context.mappingContext.mapping->map(inDataID, outDataID);
-#     ifndef NDEBUG
-      int max = context.toData->values().size();
-      std::ostringstream stream;
-      for (int i=0; (i < max) && (i < 10); i++){
-        stream << context.toData->values()[i] << " ";
-      }
-      DEBUG("First mapped values = " << stream.str());
-#     endif
+      contexts.push_back(&context);
     }
   }
+  mapDataContexts(contexts);
 
   // Clear non-initial, non-incremental mappings
   for (impl::MappingContext& context : _accessor->readMappingContexts()) {
@@ -1634,6 +1590,43 @@ void SolverInterfaceImpl:: mapReadData()
   }
 }
 
+void SolverInterfaceImpl:: mapDataContexts
+(
+  const std::vector<DataContext*>& contexts )
+{
+  TRACE(contexts.size());
+  // Group data by mapping, keeping the order of the data contexts
+  using MappingGroup = std::pair<mapping::PtrMapping, mapping::Mapping::DataIDPairs>;
+  std::vector<MappingGroup> groups;
+  for (DataContext* context : contexts) {
+    const mapping::PtrMapping& mapping = context->mappingContext.mapping;
+    auto group = std::find_if(groups.begin(), groups.end(),
+        [&mapping](const MappingGroup& g){ return g.first == mapping; });
+    if (group == groups.end()){
+      groups.emplace_back(mapping, mapping::Mapping::DataIDPairs());
+      group = groups.end() - 1;
+    }
+    group->second.emplace_back(context->fromData->getID(), context->toData->getID());
+    context->toData->values() = Eigen::VectorXd::Zero(context->toData->values().size());
+  }
+
+  for (auto& group : groups) {
+    DEBUG("Map " << group.second.size() << " data fields at once");
+    group.first->map(group.second);
+  }
+
+# ifndef NDEBUG
+  for (DataContext* context : contexts) {
+    int max = context->toData->values().size();
+    std::ostringstream stream;
+    for (int i=0; (i < max) && (i < 10); i++){
+      stream << context->toData->values()[i] << " ";
+    }
+    DEBUG("First mapped values of \"" << context->toData->getName() << "\" = " << stream.str());
+  }
+# endif
+}
+
 void SolverInterfaceImpl:: performDataActions
 (
   const std::set<action::Action::Timing>& timings,
@@ -28,6 +28,7 @@ namespace precice {
 namespace PreciceTests {
   namespace Serial {
     struct TestConfiguration;
+    struct testSetMeshElementsWithEdges;
   }
 }
 
@@ -245,6 +246,19 @@ public:
     double* positions,
     int*    ids );
 
+  /**
+   * @brief Gets vertex data ids from positions, without aborting on unknown positions.
+   *
+   * @param[out] ids IDs corresponding to positions, -1 for positions matching no vertex.
+   * @param[out] unmatched Indices of the positions matching no vertex.
+   */
+  void getMeshVertexIDsFromPositions (
+    int               meshID,
+    size_t            size,
+    double*           positions,
+    int*              ids,
+    std::vector<int>& unmatched );
+
   /// Returns the number of nodes of a mesh.
   int getMeshVertexSize ( int meshID );
 
@@ -281,6 +295,17 @@ public:
     int secondVertexID,
     int thirdVertexID );
 
+  /**
+   * @brief Sets several triangles and creates/sets edges automatically of a solver mesh.
+   *
+   * @param[in] size Number of triangles.
+   * @param[in] vertexIDs Vertex IDs of the triangles, three per triangle.
+   */
+  void setMeshTrianglesWithEdges (
+    int  meshID,
+    int  size,
+    int* vertexIDs );
+
   /// Set a quadrangle of a solver mesh.
   void setMeshQuad (
     int meshID,
@@ -297,6 +322,17 @@ public:
     int thirdVertexID,
     int fourthVertexID );
 
+  /**
+   * @brief Sets several quadrangles and creates/sets edges automatically of a solver mesh.
+   *
+   * @param[in] size Number of quadrangles.
+   * @param[in] vertexIDs Vertex IDs of the quadrangles, four per quadrangle.
+   */
+  void setMeshQuadsWithEdges (
+    int  meshID,
+    int  size,
+    int* vertexIDs );
+
   /**
    * @brief Computes and maps all write data mapped from mesh with given ID.
    *
@@ -566,6 +602,15 @@ private:
   /// Computes, performs, and resets all suitable read mappings.
   void mapReadData();
 
+  /**
+   * @brief Maps the data of the given contexts, one call to Mapping::map per mapping.
+   *
+   * Data contexts sharing a mapping are mapped together, such that the mapping
+   * traverses its coefficients or solves its interpolation system only once.
+   * The output data values are reset to zero before mapping.
+   */
+  void mapDataContexts(const std::vector<DataContext*>& contexts);
+
   /**
    * @brief Performs all data actions with given timing.
    *
@@ -601,6 +646,7 @@ private:
 
   /// To allow white box tests.
   friend struct PreciceTests::Serial::TestConfiguration;
+  friend struct PreciceTests::Serial::testSetMeshElementsWithEdges;
 };
 
 }} // namespace precice, impl
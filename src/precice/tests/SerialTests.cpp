@@ -5,6 +5,9 @@
 #include "precice/impl/Participant.hpp"
 #include "precice/impl/MeshContext.hpp"
 #include "precice/impl/DataContext.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Quad.hpp"
+#include "mesh/Triangle.hpp"
 #include "precice/SolverInterface.hpp"
 #include "precice/Constants.hpp"
 #include "utils/Globals.hpp"
@@ -1366,6 +1369,107 @@ BOOST_AUTO_TEST_CASE(testMultiCoupling, * testing::OnSize(4))
 
 }
 
+/// Test looking up vertex IDs from positions, with and without unknown positions.
+BOOST_AUTO_TEST_CASE(testGetMeshVertexIDsFromPositions)
+{
+  SolverInterface interface("SolverTwo", 0, 1);
+  config::Configuration config;
+  xml::configure(config.getXMLTag(), _pathToTests + "explicit-mpi-single.xml");
+  interface._impl->configure(config.getSolverInterfaceConfiguration());
+  int meshID = interface.getMeshID("Test-Square");
+
+  std::vector<double> positions = {0.0, 0.0, 0.0,
+                                   1.0, 0.0, 0.0,
+                                   0.0, 1.0, 0.0};
+  std::vector<int> ids(3, -1);
+  interface.setMeshVertices(meshID, 3, positions.data(), ids.data());
+
+  std::vector<int> foundIDs(3, -2);
+  interface.getMeshVertexIDsFromPositions(meshID, 3, positions.data(), foundIDs.data());
+  BOOST_TEST(foundIDs == ids);
+
+  std::vector<int> unmatched(1, 7);
+  foundIDs.assign(3, -2);
+  interface.getMeshVertexIDsFromPositions(meshID, 3, positions.data(), foundIDs.data(), unmatched);
+  BOOST_TEST(foundIDs == ids);
+  BOOST_TEST(unmatched.empty());
+
+  std::vector<double> partlyKnown = {0.0, 1.0, 0.0,
+                                     2.0, 2.0, 2.0,
+                                     0.0, 0.0, 0.0,
+                                     1.0, 0.0, 0.5};
+  std::vector<int> partlyFoundIDs(4, -2);
+  interface.getMeshVertexIDsFromPositions(meshID, 4, partlyKnown.data(), partlyFoundIDs.data(), unmatched);
+  BOOST_TEST(partlyFoundIDs == std::vector<int>({ids[2], -1, ids[0], -1}));
+  BOOST_TEST(unmatched == std::vector<int>({1, 3}));
+}
+
+/// Test setting triangles and quads with a shared edge in bulk and element by element.
+BOOST_AUTO_TEST_CASE(testSetMeshElementsWithEdges)
+{
+  SolverInterface interface("SolverTwo", 0, 1);
+  config::Configuration config;
+  xml::configure(config.getXMLTag(), _pathToTests + "explicit-mpi-single.xml");
+  interface._impl->configure(config.getSolverInterfaceConfiguration());
+  int meshID = interface.getMeshID("Test-Square");
+  mesh::PtrMesh mesh = interface._impl->_accessor->meshContext(meshID).mesh;
+
+  // Two unit squares next to each other, sharing the edge from (1,0) to (1,1)
+  std::vector<double> positions = {0.0, 0.0, 0.0,
+                                   1.0, 0.0, 0.0,
+                                   2.0, 0.0, 0.0,
+                                   0.0, 1.0, 0.0,
+                                   1.0, 1.0, 0.0,
+                                   2.0, 1.0, 0.0};
+  std::vector<int> v(6);
+
+  // Triangles element by element
+  interface.setMeshVertices(meshID, 6, positions.data(), v.data());
+  int e0 = interface.setMeshEdge(meshID, v[0], v[1]);
+  int e1 = interface.setMeshEdge(meshID, v[1], v[4]);
+  int e2 = interface.setMeshEdge(meshID, v[4], v[0]);
+  int e3 = interface.setMeshEdge(meshID, v[1], v[2]);
+  int e4 = interface.setMeshEdge(meshID, v[2], v[4]);
+  interface.setMeshTriangle(meshID, e0, e1, e2);
+  interface.setMeshTriangle(meshID, e3, e4, e1);
+  size_t edgesPerElement     = mesh->edges().size();
+  size_t trianglesPerElement = mesh->triangles().size();
+  BOOST_TEST(edgesPerElement == 5);
+  BOOST_TEST(trianglesPerElement == 2);
+
+  // The same triangles in bulk on new vertices
+  interface.setMeshVertices(meshID, 6, positions.data(), v.data());
+  std::vector<int> triangles = {v[0], v[1], v[4],
+                                v[1], v[2], v[4]};
+  interface.setMeshTrianglesWithEdges(meshID, 2, triangles.data());
+  BOOST_TEST(mesh->edges().size() == 2 * edgesPerElement);
+  BOOST_TEST(mesh->triangles().size() == 2 * trianglesPerElement);
+  mesh::Edge* shared = mesh->findEdge(v[1], v[4]);
+  BOOST_TEST_REQUIRE(shared != nullptr);
+  BOOST_TEST(&mesh->triangles()[2].edge(1) == shared);
+  BOOST_TEST(&mesh->triangles()[3].edge(2) == shared);
+
+  // Quads element by element
+  interface.setMeshVertices(meshID, 6, positions.data(), v.data());
+  interface.setMeshQuadWithEdges(meshID, v[0], v[1], v[4], v[3]);
+  interface.setMeshQuadWithEdges(meshID, v[1], v[2], v[5], v[4]);
+  size_t edgesBefore = mesh->edges().size();
+  BOOST_TEST(edgesBefore == 2 * edgesPerElement + 7);
+  BOOST_TEST(mesh->quads().size() == 2);
+
+  // The same quads in bulk on new vertices
+  interface.setMeshVertices(meshID, 6, positions.data(), v.data());
+  std::vector<int> quads = {v[0], v[1], v[4], v[3],
+                            v[1], v[2], v[5], v[4]};
+  interface.setMeshQuadsWithEdges(meshID, 2, quads.data());
+  BOOST_TEST(mesh->edges().size() == edgesBefore + 7);
+  BOOST_TEST(mesh->quads().size() == 4);
+  shared = mesh->findEdge(v[1], v[4]);
+  BOOST_TEST_REQUIRE(shared != nullptr);
+  BOOST_TEST(&mesh->quads()[2].edge(1) == shared);
+  BOOST_TEST(&mesh->quads()[3].edge(3) == shared);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 #endif // PRECICE_NO_MPI
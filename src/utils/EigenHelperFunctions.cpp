@@ -7,6 +7,7 @@
 
 
 #include "EigenHelperFunctions.hpp"
+#include <cstring>
 
 namespace precice {
 namespace utils {
@@ -17,9 +18,9 @@ void shiftSetFirst
     Eigen::MatrixXd& A, Eigen::VectorXd& v)
 {
   assertion(v.size() == A.rows(), v.size(), A.rows());
-  // A.bottomRightCorner(n, m - 1) = A.topLeftCorner(n, m - 1);
-  for(auto i = A.cols()-1; i > 0; i--)
-        A.col(i) = A.col(i-1);
+  // columns are contiguous in memory, shift all but the last one by one column at once
+  if (A.cols() > 1)
+    std::memmove(A.col(1).data(), A.col(0).data(), sizeof(double) * A.rows() * (A.cols() - 1));
   A.col(0) = v;
 }
 
@@ -33,11 +34,11 @@ void appendFront
     A = v;
   } else {
     assertion(v.size() == n, v.size(), A.rows());
-    A.conservativeResize(n, m + 1);
-    //A.topRightCorner(n, m) = A.topLeftCorner(n, m); // bad error, reason unknown!
-    for(auto i = A.cols()-1; i > 0; i--)
-      A.col(i) = A.col(i-1);
-    A.col(0) = v;
+    // copy the old columns only once, instead of resizing and shifting afterwards
+    Eigen::MatrixXd extended(n, m + 1);
+    extended.col(0)       = v;
+    extended.rightCols(m) = A;
+    A.swap(extended);
   }
 }
 
@@ -46,8 +47,8 @@ void removeColumnFromMatrix
     Eigen::MatrixXd& A, int col)
 {
   assertion(col < A.cols() && col >= 0, col, A.cols());
-  for (int j = col; j < A.cols() - 1; j++)
-    A.col(j) = A.col(j + 1);
+  if (col < A.cols() - 1)
+    std::memmove(A.col(col).data(), A.col(col + 1).data(), sizeof(double) * A.rows() * (A.cols() - col - 1));
 
   A.conservativeResize(A.rows(), A.cols() - 1);
 }
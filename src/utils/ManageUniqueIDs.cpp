@@ -11,24 +11,20 @@ ManageUniqueIDs:: ManageUniqueIDs ()
 
 int ManageUniqueIDs:: getFreeID ()
 {
-   bool notFound = true;
-   while (notFound) {
-      if (_ids.count(_lowerLimit) == 0) {
-         notFound = false;
-      }
-      _lowerLimit++;
-   }
-   _ids.insert(_lowerLimit - 1);
-   return _lowerLimit - 1;
+   mergeFollowingIDs();
+   return _lowerLimit++;
 }
 
 bool ManageUniqueIDs:: insertID ( int id )
 {
-   if (_ids.count(id) != 0)
+   mergeFollowingIDs();
+   if (id >= 0 && id < _lowerLimit)
       return false;
-   else
-      _ids.insert (id);
-   return true;
+   if (id == _lowerLimit) {
+      _lowerLimit++;
+      return true;
+   }
+   return _ids.insert(id).second;
 }
 
 void ManageUniqueIDs:: resetIDs ()
@@ -37,4 +33,13 @@ void ManageUniqueIDs:: resetIDs ()
    _lowerLimit = 0;
 }
 
+void ManageUniqueIDs:: mergeFollowingIDs ()
+{
+   auto iter = _ids.find(_lowerLimit);
+   while (iter != _ids.end() && *iter == _lowerLimit) {
+      iter = _ids.erase(iter);
+      _lowerLimit++;
+   }
+}
+
 }} // namespace precice, utils
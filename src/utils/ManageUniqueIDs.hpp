@@ -8,6 +8,10 @@ namespace utils {
 
 /**
  * @brief Manages a set of unique IDs.
+ *
+ * All IDs in [0, _lowerLimit) are in use, such that sequentially obtained or
+ * inserted IDs only advance a counter. Only IDs that are inserted outside of
+ * this interval are stored explicitly, until the interval grows over them.
  */
 class ManageUniqueIDs
 {
@@ -38,11 +42,14 @@ public:
 
 private:
 
-   // @brief Stores all used IDs.
+   // @brief Stores used IDs that are not in [0, _lowerLimit).
    std::set<int> _ids;
 
-   // @brief Marks next ID to be given, from lower to higher values.
+   // @brief Marks next ID to be given, from lower to higher values. All IDs below are used.
    int _lowerLimit;
+
+   /// Advances _lowerLimit over all stored IDs that directly follow it.
+   void mergeFollowingIDs ();
 };
 
 }} // namespace precice, utils
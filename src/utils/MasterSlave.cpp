@@ -114,6 +114,28 @@ double MasterSlave:: dot(const Eigen::VectorXd& vec1, const Eigen::VectorXd& vec
   return globalSum;
 }
 
+Eigen::VectorXd MasterSlave:: allreduceNorms(const Eigen::VectorXd& localSquaredNorms)
+{
+  TRACE(localSquaredNorms.size());
+  return allreduceSquaredNorms(localSquaredNorms).cwiseSqrt();
+}
+
+Eigen::VectorXd MasterSlave:: allreduceSquaredNorms(const Eigen::VectorXd& localSquaredNorms)
+{
+  TRACE(localSquaredNorms.size());
+
+  if((not _masterMode && not _slaveMode) || localSquaredNorms.size() == 0){
+    return localSquaredNorms;
+  }
+
+  assertion(_communication.get() != nullptr);
+  assertion(_communication->isConnected());
+  Eigen::VectorXd localSums = localSquaredNorms; // modified by the reduction
+  Eigen::VectorXd globalSums(localSquaredNorms.size());
+  allreduceSum(localSums.data(), globalSums.data(), localSums.size());
+  return globalSums;
+}
+
 void MasterSlave:: reset()
 {
   TRACE();
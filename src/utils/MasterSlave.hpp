@@ -38,6 +38,30 @@ public:
   // The dot product of 2 vectors is calculated on distributed data.
   static double dot(const Eigen::VectorXd& vec1, const Eigen::VectorXd& vec2);
 
+  /// The squared l2 norm of the local part of a distributed vector, summed up as in l2norm().
+  template<typename Derived>
+  static double localSquaredNorm(const Eigen::MatrixBase<Derived>& vec)
+  {
+    if(not _masterMode && not _slaveMode){
+      return vec.squaredNorm();
+    }
+    double localSum2 = 0.0;
+    for(int i=0; i<vec.size(); i++){
+      localSum2 += vec(i)*vec(i);
+    }
+    return localSum2;
+  }
+
+  /**
+   * @brief The l2 norms of several vectors are calculated on distributed data with one reduction.
+   *
+   * @param[in] localSquaredNorms Squared l2 norms of the local parts of the vectors, see localSquaredNorm()
+   */
+  static Eigen::VectorXd allreduceNorms(const Eigen::VectorXd& localSquaredNorms);
+
+  /// The squared l2 norms of several vectors are calculated on distributed data with one reduction.
+  static Eigen::VectorXd allreduceSquaredNorms(const Eigen::VectorXd& localSquaredNorms);
+
   static void reset();
 
   static void reduceSum(double* sendData, double* rcvData, int size);
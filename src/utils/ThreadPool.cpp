@@ -0,0 +1,86 @@
+#include "ThreadPool.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace utils {
+
+ThreadPool::ThreadPool(int threadCount)
+{
+  assertion(threadCount >= 1, threadCount);
+  _workers.reserve(threadCount - 1);
+  for (int t = 1; t < threadCount; t++) {
+    _workers.emplace_back(&ThreadPool::work, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _changed.notify_all();
+  for (std::thread &worker : _workers) {
+    worker.join();
+  }
+}
+
+int ThreadPool::getThreadCount() const
+{
+  return _workers.size() + 1;
+}
+
+void ThreadPool::parallelFor(int size, const std::function<void(int)> &func)
+{
+  if (_workers.empty() or size <= 1) {
+    for (int i = 0; i < size; i++) {
+      func(i);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _func        = &func;
+    _size        = size;
+    _next        = 0;
+    _busyWorkers = _workers.size();
+    _loop++;
+  }
+  _changed.notify_all();
+  runIndices();
+
+  // The loop body must stay alive until all workers are done with it
+  std::unique_lock<std::mutex> lock(_mutex);
+  _changed.wait(lock, [this] { return _busyWorkers == 0; });
+  _func = nullptr;
+}
+
+void ThreadPool::work()
+{
+  int lastLoop = 0;
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _changed.wait(lock, [this, lastLoop] { return _stop or _loop != lastLoop; });
+    if (_stop) {
+      return;
+    }
+    lastLoop = _loop;
+    lock.unlock();
+    runIndices();
+    lock.lock();
+    _busyWorkers--;
+    if (_busyWorkers == 0) {
+      _changed.notify_all();
+    }
+  }
+}
+
+void ThreadPool::runIndices()
+{
+  for (int i = _next++; i < _size; i = _next++) {
+    (*_func)(i);
+  }
+}
+
+}} // namespace precice, utils
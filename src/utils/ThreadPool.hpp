@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+/**
+ * @brief Fixed set of worker threads, which are reused for all parallel loops.
+ *
+ * The threads are started once in the constructor and wait for work in between
+ * the loops, hence a loop does not pay for starting threads. The calling thread
+ * takes part in the work, such that a pool of one thread runs all loops
+ * serially without any worker thread.
+ *
+ * Loops must not be started concurrently from several threads.
+ */
+class ThreadPool
+{
+public:
+  /// Starts threadCount - 1 worker threads.
+  explicit ThreadPool(int threadCount = 1);
+
+  /// Stops and joins the worker threads.
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /// Returns the number of threads running a loop, including the calling thread.
+  int getThreadCount() const;
+
+  /**
+   * @brief Calls func(i) for all i in [0, size) and returns, when all calls are done.
+   *
+   * Indices are handed out one by one, hence the load is balanced also if the
+   * work per index varies, e.g., when filling a triangular matrix. func has to
+   * be safe to call concurrently for different indices and must not throw.
+   */
+  void parallelFor(int size, const std::function<void(int)> &func);
+
+private:
+  std::vector<std::thread> _workers;
+
+  std::mutex _mutex;
+
+  /// Signals a new loop or stop to the workers, and the end of a loop to the caller.
+  std::condition_variable _changed;
+
+  /// Loop body of the current loop.
+  const std::function<void(int)> *_func = nullptr;
+
+  /// Number of indices of the current loop.
+  int _size = 0;
+
+  /// Next index of the current loop to be handed out.
+  std::atomic<int> _next{0};
+
+  /// Counts the loops, such that workers recognize a new one.
+  int _loop = 0;
+
+  /// Number of workers, which have not finished the current loop yet.
+  int _busyWorkers = 0;
+
+  bool _stop = false;
+
+  /// Waits for loops and takes part in them, until the pool is destroyed.
+  void work();
+
+  /// Calls the loop body for indices handed out, until all indices are taken.
+  void runIndices();
+};
+
+}} // namespace precice, utils
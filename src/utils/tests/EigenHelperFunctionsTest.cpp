@@ -0,0 +1,46 @@
+#include <Eigen/Core>
+#include "testing/Testing.hpp"
+#include "utils/EigenHelperFunctions.hpp"
+
+using namespace precice;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(EigenHelperFunctions)
+
+BOOST_AUTO_TEST_CASE(ColumnHistory)
+{
+  Eigen::MatrixXd A;
+  Eigen::VectorXd v(3);
+
+  v << 1.0, 2.0, 3.0;
+  utils::appendFront(A, v);
+  v << 4.0, 5.0, 6.0;
+  utils::appendFront(A, v);
+  Eigen::MatrixXd expected(3, 2);
+  expected << 4.0, 1.0,
+              5.0, 2.0,
+              6.0, 3.0;
+  BOOST_TEST(testing::equals(A, expected));
+
+  v << 7.0, 8.0, 9.0;
+  utils::shiftSetFirst(A, v);
+  expected << 7.0, 4.0,
+              8.0, 5.0,
+              9.0, 6.0;
+  BOOST_TEST(testing::equals(A, expected));
+
+  v << 10.0, 11.0, 12.0;
+  utils::appendFront(A, v);
+  utils::removeColumnFromMatrix(A, 1);
+  expected << 10.0, 4.0,
+              11.0, 5.0,
+              12.0, 6.0;
+  BOOST_TEST(testing::equals(A, expected));
+
+  utils::removeColumnFromMatrix(A, 1);
+  BOOST_TEST(A.cols() == 1);
+  BOOST_TEST(testing::equals(A.col(0), v));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
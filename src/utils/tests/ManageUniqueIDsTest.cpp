@@ -18,4 +18,25 @@ BOOST_AUTO_TEST_CASE(UniqueIDs)
   BOOST_TEST(id == 3);
 }
 
+BOOST_AUTO_TEST_CASE(UniqueIDsInsertedAhead)
+{
+  ManageUniqueIDs uniqueIDs;
+  BOOST_TEST(uniqueIDs.insertID(1));
+  BOOST_TEST(uniqueIDs.insertID(3));
+  BOOST_TEST(uniqueIDs.insertID(-2));
+  BOOST_TEST(not uniqueIDs.insertID(3));
+  BOOST_TEST(uniqueIDs.getFreeID() == 0);
+  BOOST_TEST(not uniqueIDs.insertID(1));
+  BOOST_TEST(uniqueIDs.getFreeID() == 2);
+  BOOST_TEST(uniqueIDs.getFreeID() == 4);
+  BOOST_TEST(not uniqueIDs.insertID(0));
+  BOOST_TEST(not uniqueIDs.insertID(-2));
+  BOOST_TEST(uniqueIDs.insertID(5));
+  BOOST_TEST(uniqueIDs.getFreeID() == 6);
+
+  uniqueIDs.resetIDs();
+  BOOST_TEST(uniqueIDs.getFreeID() == 0);
+  BOOST_TEST(uniqueIDs.insertID(1));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
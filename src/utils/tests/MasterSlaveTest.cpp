@@ -0,0 +1,42 @@
+#ifndef PRECICE_NO_MPI
+
+#include <Eigen/Core>
+#include "testing/Fixtures.hpp"
+#include "testing/Testing.hpp"
+#include "utils/MasterSlave.hpp"
+
+using namespace precice;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(MasterSlave)
+
+BOOST_AUTO_TEST_CASE(AllreduceNorms,
+                     * testing::OnSize(4)
+                     * boost::unit_test::fixture<testing::MasterComFixture>())
+{
+  int rank = utils::MasterSlave::_rank;
+
+  // Local parts of three distributed vectors, the last one is empty on the master
+  Eigen::VectorXd a = Eigen::VectorXd::Constant(2, rank + 1.0);
+  Eigen::VectorXd b = Eigen::VectorXd::Constant(1, rank);
+  Eigen::VectorXd c = Eigen::VectorXd::Ones(rank);
+
+  Eigen::VectorXd localSquaredNorms(3);
+  localSquaredNorms << utils::MasterSlave::localSquaredNorm(a),
+                       utils::MasterSlave::localSquaredNorm(b),
+                       utils::MasterSlave::localSquaredNorm(c);
+  Eigen::Vector3d expected(2.0 * (1 + 4 + 9 + 16), 0 + 1 + 4 + 9, 0 + 1 + 2 + 3);
+
+  Eigen::VectorXd squaredNorms = utils::MasterSlave::allreduceSquaredNorms(localSquaredNorms);
+  BOOST_TEST(testing::equals(squaredNorms, expected));
+
+  Eigen::VectorXd norms = utils::MasterSlave::allreduceNorms(localSquaredNorms);
+  BOOST_TEST(testing::equals(norms, expected.cwiseSqrt()));
+  BOOST_TEST(norms(0) == utils::MasterSlave::l2norm(a));
+  BOOST_TEST(norms(1) == utils::MasterSlave::l2norm(b));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // MasterSlave
+BOOST_AUTO_TEST_SUITE_END() // UtilsTests
+
+#endif // not PRECICE_NO_MPI
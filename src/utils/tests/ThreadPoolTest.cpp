@@ -0,0 +1,34 @@
+#include "testing/Testing.hpp"
+#include "utils/ThreadPool.hpp"
+#include <algorithm>
+#include <vector>
+
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+
+BOOST_AUTO_TEST_CASE(ThreadPoolSerial)
+{
+  ThreadPool pool;
+  BOOST_TEST(pool.getThreadCount() == 1);
+  std::vector<int> visits(100, 0);
+  pool.parallelFor(visits.size(), [&](int i){ visits[i]++; });
+  BOOST_TEST(std::count(visits.begin(), visits.end(), 1) == 100);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadPoolReuse)
+{
+  ThreadPool pool(4);
+  BOOST_TEST(pool.getThreadCount() == 4);
+  std::vector<int> visits(1000, 0);
+  // The same workers run all loops, each index is visited once per loop
+  for (int loop = 0; loop < 20; loop++) {
+    pool.parallelFor(visits.size(), [&](int i){ visits[i]++; });
+  }
+  BOOST_TEST(std::count(visits.begin(), visits.end(), 20) == 1000);
+
+  // Empty ranges do not call func
+  pool.parallelFor(0, [](int){ BOOST_TEST(false); });
+}
+
+BOOST_AUTO_TEST_SUITE_END()